@@ -13,6 +13,7 @@ static Std_ReturnType lcd_4bits_send_enable_signal(const lcd_4bit_t *lcd);
 static Std_ReturnType lcd_8bits_send_enable_signal(const lcd_8bit_t *lcd);
 static Std_ReturnType lcd_8bit_set_cursor(const lcd_8bit_t *lcd, uint8 row, uint8 column);
 static Std_ReturnType lcd_4bit_set_cursor(const lcd_4bit_t *lcd, uint8 row, uint8 column);
+static uint8 lcd_convert_digits(uint32 value, uint8 *str);
 
 /**
  * @brief Initializes a 4-bit mode character LCD.
@@ -469,8 +470,7 @@ Std_ReturnType convert_uint8_to_string(uint8 value, uint8 *str)
     }
     else
     {   
-        memset(str, '\0', 4);
-        sprintf(str, "%u", value);
+        str[lcd_convert_digits(value, str)] = '\0';
     }
     return ret;
 }
@@ -487,8 +487,7 @@ Std_ReturnType convert_uint8_to_string(uint8 value, uint8 *str)
 Std_ReturnType convert_uint16_to_string(uint16 value, uint8 *str)
 {
     Std_ReturnType ret = E_OK;
-    uint8 tempStr[6] = {0};
-    uint8 dataCounter = 0;
+    uint8 l_index = ZERO_INIT;
 
     if(NULL == str)
     {
@@ -496,16 +495,13 @@ Std_ReturnType convert_uint16_to_string(uint16 value, uint8 *str)
     }
     else
     {   
-        memset(str, ' ', 5);
-        str[5] = '\0';
-
-        sprintf(tempStr, "%u", value);
-        while (tempStr[dataCounter] != '\0')
+        //Left justified and space padded, a shorter value overwrites the previous one on the LCD
+        l_index = lcd_convert_digits(value, str);
+        while(l_index < 5)
         {
-            str[dataCounter] = tempStr[dataCounter];
-            dataCounter++;
+            str[l_index++] = ' ';
         }
-             
+        str[5] = '\0';
     }
     return ret;
 }
@@ -529,8 +525,7 @@ Std_ReturnType convert_uint32_to_string(uint32 value, uint16 *str)
     }
     else
     {   
-        memset(str, '\0', 11);
-        sprintf(str, "%u", value);
+        ((uint8 *)str)[lcd_convert_digits(value, (uint8 *)str)] = '\0';
     }
     return ret;
 }
@@ -660,4 +655,30 @@ static Std_ReturnType lcd_4bit_set_cursor(const lcd_4bit_t *lcd, uint8 row, uint
         break;
     }
     return ret;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Writes the decimal digits of a value, without the terminating null.
+ * 
+ * @param value The value to convert.
+ * @param str A pointer to the destination, at least 10 characters for a 32-bit value.
+ * @return uint8 The number of digits written.
+ */
+static uint8 lcd_convert_digits(uint32 value, uint8 *str)
+{
+    uint8 l_digits[10];
+    uint8 l_count = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+
+    //Least significant digit first, then reversed into the string
+    do
+    {
+        l_digits[l_count++] = (uint8)('0' + (uint8)(value % 10));
+        value /= 10;
+    }while(value);
+    while(l_count)
+    {
+        str[l_index++] = l_digits[--l_count];
+    }
+    return l_index;
+}
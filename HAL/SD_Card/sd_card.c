@@ -0,0 +1,648 @@
+/*
+ * File:   sd_card.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+
+#include "sd_card.h"
+
+static Std_ReturnType sd_card_select(sd_card_t *card);
+static void sd_card_deselect(sd_card_t *card);
+static Std_ReturnType sd_card_wait_ready(uint16 polls);
+static Std_ReturnType sd_card_command(uint8 command, uint32 argument, uint8 *r1);
+static Std_ReturnType sd_card_init_command(sd_card_t *card, uint8 command, uint32 argument,
+                                           uint8 *r1, uint8 *response);
+static Std_ReturnType sd_card_receive_block(uint8 *buf);
+static Std_ReturnType sd_card_send_block(uint8 token, const uint8 *buf);
+static Std_ReturnType sd_card_read_blocks(sd_card_t *card, uint32 sector, uint8 *buf, uint16 count);
+static Std_ReturnType sd_card_write_blocks(sd_card_t *card, uint32 sector, const uint8 *buf, uint16 count);
+#if SD_CARD_CFG_CRC==SD_CARD_CFG_FEATURE_ENABLE
+static uint8 sd_card_crc7(const uint8 *data, uint8 len);
+static uint16 sd_card_crc16(const uint8 *data, uint16 len);
+
+//CRC16-CCITT (polynomial 0x1021), one nibble per lookup
+static const uint16 sd_card_crc16_table[16] = {
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU
+};
+#endif
+
+/**
+ * @brief Initializes the card: SPI mode entry, CMD0, CMD8, ACMD41 (CMD1 for MMC) and CMD58.
+ *
+ * @param card A pointer to the card to fill.
+ * @param chip_select A pointer to the chip select pin.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: No card, unusable card, or timeout.
+ */
+Std_ReturnType sd_card_init(sd_card_t *card, const pin_config_t *chip_select)
+{
+    Std_ReturnType ret = E_OK;
+    spi_t l_spi;
+    uint8 l_r1 = 0xFFU;
+    uint8 l_response[4] = {0};
+    uint8 l_command = SD_CARD_ACMD41_SD_SEND_OP_COND;
+    uint32 l_argument = ZERO_INIT;
+    uint16 l_retries = ZERO_INIT;
+
+    if(NULL == card || NULL == chip_select)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        card->type = SD_CARD_TYPE_NONE;
+#if SD_CARD_CFG_CACHE==SD_CARD_CFG_FEATURE_ENABLE
+        card->cache_sector = SD_CARD_NO_SECTOR;
+        card->cache_dirty = ZERO_INIT;
+#endif
+        //Mode 0, identification runs below 400 kHz
+        l_spi.mode = SPI_MASTER_FOSC_DIV_64;
+        l_spi.master_waveform = SPI_CLK_IDLE_LOW_TX_TRAILING_FALLING;
+        l_spi.master_sample = SPI_MASTER_SAMPLE_MIDDLE_CFG;
+        ret = SPI_Device_Init(&card->device, &l_spi, chip_select);
+        //At least 74 clocks with CS high enter the SPI mode
+        if(E_OK == ret)
+        {
+            ret = SPI_Bus_Acquire(&card->device);
+            ret &= SPI_Master_Transfer(NULL, NULL, NULL, 10);
+            ret &= SPI_Bus_Release();
+        }else{/* Nothing */}
+        //CMD0 with CS low resets the card into SPI mode
+        l_retries = SD_CARD_CMD0_RETRIES;
+        while(E_OK == ret && SD_CARD_R1_IDLE != l_r1 && l_retries)
+        {
+            //No response yet is expected after power up, only R1 and the retries decide
+            (void)sd_card_init_command(card, SD_CARD_CMD0_GO_IDLE, 0, &l_r1, NULL);
+            l_retries--;
+        }
+        if(E_OK == ret && SD_CARD_R1_IDLE == l_r1)
+        {
+            //CMD8 is only known to version 2 cards, they echo the check pattern
+            ret = sd_card_init_command(card, SD_CARD_CMD8_SEND_IF_COND, SD_CARD_CMD8_ARGUMENT,
+                                       &l_r1, l_response);
+            if(SD_CARD_R1_IDLE == l_r1 && 0x01U == (l_response[2] & 0x0FU) && 0xAAU == l_response[3])
+            {
+                card->type = SD_CARD_TYPE_SD_V2;
+                l_argument = SD_CARD_ACMD41_HCS;
+            }
+            else if(l_r1 & SD_CARD_R1_ILLEGAL_COMMAND)
+            {
+                card->type = SD_CARD_TYPE_SD_V1;
+                //Still idle, only the illegal command bit is set
+                l_r1 = SD_CARD_R1_IDLE;
+            }
+            else
+            {
+                //Voltage not supported
+                ret = E_NOT_OK;
+            }
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+        //ACMD41 (CMD1 for MMC) until the card leaves the idle state
+        l_retries = SD_CARD_INIT_RETRIES;
+        while(E_OK == ret && SD_CARD_R1_IDLE == l_r1)
+        {
+            if(SD_CARD_ACMD41_SD_SEND_OP_COND == l_command)
+            {
+                ret = sd_card_init_command(card, SD_CARD_CMD55_APP_CMD, 0, &l_r1, NULL);
+            }else{/* Nothing */}
+            ret &= sd_card_init_command(card, l_command, l_argument, &l_r1, NULL);
+            if(E_OK == ret && SD_CARD_TYPE_SD_V1 == card->type && (l_r1 & SD_CARD_R1_ILLEGAL_COMMAND))
+            {
+                //Not an SD card
+                card->type = SD_CARD_TYPE_MMC;
+                l_command = SD_CARD_CMD1_SEND_OP_COND;
+                l_r1 = SD_CARD_R1_IDLE;
+            }else{/* Nothing */}
+            l_retries--;
+            if(ZERO_INIT == l_retries)
+            {
+                ret = E_NOT_OK;
+            }else{/* Nothing */}
+        }
+        if(E_OK == ret && ZERO_INIT != l_r1)
+        {
+            ret = E_NOT_OK;
+        }else{/* Nothing */}
+        //CCS in the OCR tells block addressing
+        if(E_OK == ret && SD_CARD_TYPE_SD_V2 == card->type)
+        {
+            ret = sd_card_init_command(card, SD_CARD_CMD58_READ_OCR, 0, &l_r1, l_response);
+            if(E_OK == ret && ZERO_INIT == l_r1 && (l_response[0] & SD_CARD_OCR_CCS))
+            {
+                card->type = SD_CARD_TYPE_SDHC;
+            }else{/* Nothing */}
+        }else{/* Nothing */}
+        //Byte addressed cards may default to another block length
+        if(E_OK == ret && SD_CARD_TYPE_SDHC != card->type)
+        {
+            ret = sd_card_init_command(card, SD_CARD_CMD16_SET_BLOCKLEN, SD_CARD_BLOCK_SIZE, &l_r1, NULL);
+            if(ZERO_INIT != l_r1)
+            {
+                ret = E_NOT_OK;
+            }else{/* Nothing */}
+        }else{/* Nothing */}
+#if SD_CARD_CFG_CRC==SD_CARD_CFG_FEATURE_ENABLE
+        if(E_OK == ret)
+        {
+            ret = sd_card_init_command(card, SD_CARD_CMD59_CRC_ON_OFF, 1, &l_r1, NULL);
+            if(ZERO_INIT != l_r1)
+            {
+                ret = E_NOT_OK;
+            }else{/* Nothing */}
+        }else{/* Nothing */}
+#endif
+        if(E_OK == ret)
+        {
+            //Identification done, full speed from now on
+            card->device.sspcon1 = (uint8)((card->device.sspcon1 & (uint8)~SD_CARD_SSPM_MASK) |
+                                           (uint8)SPI_MASTER_FOSC_DIV_4);
+        }
+        else
+        {
+            card->type = SD_CARD_TYPE_NONE;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads blocks, CMD17 for one block and CMD18 for several.
+ *
+ * @param card A pointer to the card.
+ * @param sector The first block number.
+ * @param buf A buffer of count * 512 bytes.
+ * @param count Number of blocks.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType sd_card_read(sd_card_t *card, uint32 sector, uint8 *buf, uint16 count)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == card || NULL == buf || ZERO_INIT == count || SD_CARD_TYPE_NONE == card->type)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+#if SD_CARD_CFG_CACHE==SD_CARD_CFG_FEATURE_ENABLE
+        //The card holds an old copy of a modified cached sector
+        if(card->cache_dirty && (card->cache_sector - sector) < count)
+        {
+            ret = sd_card_cache_flush(card);
+        }else{/* Nothing */}
+        if(E_OK == ret)
+#endif
+        {
+            ret = sd_card_read_blocks(card, sector, buf, count);
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Writes blocks, CMD24 for one block and CMD25 for several.
+ *
+ * @param card A pointer to the card.
+ * @param sector The first block number.
+ * @param buf The data, count * 512 bytes.
+ * @param count Number of blocks.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType sd_card_write(sd_card_t *card, uint32 sector, const uint8 *buf, uint16 count)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == card || NULL == buf || ZERO_INIT == count || SD_CARD_TYPE_NONE == card->type)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+#if SD_CARD_CFG_CACHE==SD_CARD_CFG_FEATURE_ENABLE
+        //The written data replaces the cached copy, modified or not
+        if((card->cache_sector - sector) < count)
+        {
+            card->cache_sector = SD_CARD_NO_SECTOR;
+            card->cache_dirty = ZERO_INIT;
+        }else{/* Nothing */}
+#endif
+        ret = sd_card_write_blocks(card, sector, buf, count);
+    }
+    return ret;
+}
+
+#if SD_CARD_CFG_CACHE==SD_CARD_CFG_FEATURE_ENABLE
+/**
+ * @brief Brings a sector into the cache and returns its address.
+ *
+ * @param card A pointer to the card.
+ * @param sector The block number.
+ * @param data A pointer to store the address of the cached sector.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType sd_card_cache_get(sd_card_t *card, uint32 sector, uint8 **data)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == card || NULL == data || SD_CARD_NO_SECTOR == sector || SD_CARD_TYPE_NONE == card->type)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(sector != card->cache_sector)
+        {
+            //Miss: write the modified sector back before reusing the buffer
+            ret = sd_card_cache_flush(card);
+            if(E_OK == ret)
+            {
+                card->cache_sector = SD_CARD_NO_SECTOR;
+                ret = sd_card_read_blocks(card, sector, card->cache, 1);
+            }else{/* Nothing */}
+            if(E_OK == ret)
+            {
+                card->cache_sector = sector;
+            }else{/* Nothing */}
+        }else{/* Nothing */}
+        *data = card->cache;
+    }
+    return ret;
+}
+
+/**
+ * @brief Marks the cached sector as modified, it is written back on a miss or a flush.
+ *
+ * @param card A pointer to the card.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: The cache is empty.
+ */
+Std_ReturnType sd_card_cache_mark_dirty(sd_card_t *card)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == card || SD_CARD_NO_SECTOR == card->cache_sector)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        card->cache_dirty = 1;
+    }
+    return ret;
+}
+
+/**
+ * @brief Writes the cached sector back if it was modified.
+ *
+ * @param card A pointer to the card.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType sd_card_cache_flush(sd_card_t *card)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == card)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(card->cache_dirty)
+    {
+        ret = sd_card_write_blocks(card, card->cache_sector, card->cache, 1);
+        if(E_OK == ret)
+        {
+            card->cache_dirty = ZERO_INIT;
+        }else{/* Nothing */}
+    }
+    else
+    {
+        /* Nothing */
+    }
+    return ret;
+}
+#endif
+
+/**
+ * @brief Helper function to configure the bus for the card and select it
+ */
+static Std_ReturnType sd_card_select(sd_card_t *card)
+{
+    Std_ReturnType ret = E_OK;
+
+    ret = SPI_Bus_Acquire(&card->device);
+    if(E_OK == ret)
+    {
+        ret = gpio_pin_write(&card->device.slave_select, GPIO_LOW);
+        if(E_OK != ret)
+        {
+            SPI_Bus_Release();
+        }else{/* Nothing */}
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief Helper function to deselect the card and release the bus
+ *
+ * The card only releases its data output on the clock edge after CS goes high.
+ */
+static void sd_card_deselect(sd_card_t *card)
+{
+    gpio_pin_write(&card->device.slave_select, GPIO_HIGH);
+    SPI_Transfer_data(SPI_DUMMY_BYTE);
+    SPI_Bus_Release();
+}
+
+/**
+ * @brief Helper function to wait until the card stops holding its output low (busy)
+ */
+static Std_ReturnType sd_card_wait_ready(uint16 polls)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    while(E_NOT_OK == ret && polls)
+    {
+        if(0xFFU == SPI_Transfer_data(SPI_DUMMY_BYTE))
+        {
+            ret = E_OK;
+        }else{/* Nothing */}
+        polls--;
+    }
+    return ret;
+}
+
+/**
+ * @brief Helper function to send a command frame and read its R1 response, the card is selected
+ */
+static Std_ReturnType sd_card_command(uint8 command, uint32 argument, uint8 *r1)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_frame[6];
+    uint8 l_polls = SD_CARD_R1_POLLS;
+
+    l_frame[0] = (uint8)(0x40U | command);
+    l_frame[1] = (uint8)(argument >> 24);
+    l_frame[2] = (uint8)(argument >> 16);
+    l_frame[3] = (uint8)(argument >> 8);
+    l_frame[4] = (uint8)argument;
+#if SD_CARD_CFG_CRC==SD_CARD_CFG_FEATURE_ENABLE
+    l_frame[5] = sd_card_crc7(l_frame, 5);
+#else
+    //Only CMD0 and CMD8 are checked while the card CRC is off
+    if(SD_CARD_CMD0_GO_IDLE == command)
+    {
+        l_frame[5] = 0x95U;
+    }
+    else if(SD_CARD_CMD8_SEND_IF_COND == command)
+    {
+        l_frame[5] = 0x87U;
+    }
+    else
+    {
+        l_frame[5] = 0x01U;
+    }
+#endif
+    //CMD12 interrupts a data transfer and CMD0 may find the card in any state
+    if(SD_CARD_CMD12_STOP != command && SD_CARD_CMD0_GO_IDLE != command)
+    {
+        ret = sd_card_wait_ready(SD_CARD_WRITE_TIMEOUT_POLLS);
+    }else{/* Nothing */}
+    if(E_OK == ret)
+    {
+        ret = SPI_Master_Transfer(NULL, l_frame, NULL, 6);
+        if(SD_CARD_CMD12_STOP == command)
+        {
+            //Stuff byte
+            SPI_Transfer_data(SPI_DUMMY_BYTE);
+        }else{/* Nothing */}
+        //R1 starts with a 0 bit
+        do
+        {
+            *r1 = SPI_Transfer_data(SPI_DUMMY_BYTE);
+            l_polls--;
+        }while((*r1 & 0x80U) && l_polls);
+        if(*r1 & 0x80U)
+        {
+            ret = E_NOT_OK;
+        }else{/* Nothing */}
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief Helper function to run an identification command on its own, with 4 response bytes for R3 and R7
+ */
+static Std_ReturnType sd_card_init_command(sd_card_t *card, uint8 command, uint32 argument,
+                                           uint8 *r1, uint8 *response)
+{
+    Std_ReturnType ret = E_OK;
+
+    ret = sd_card_select(card);
+    if(E_OK == ret)
+    {
+        ret = sd_card_command(command, argument, r1);
+        if(E_OK == ret && NULL != response)
+        {
+            ret = SPI_Master_Transfer(NULL, NULL, response, 4);
+        }else{/* Nothing */}
+        sd_card_deselect(card);
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief Helper function to receive a data block: start token, 512 bytes and the CRC
+ */
+static Std_ReturnType sd_card_receive_block(uint8 *buf)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_token = 0xFFU;
+    uint8 l_crc[2];
+    uint16 l_polls = SD_CARD_READ_TIMEOUT_POLLS;
+
+    //0xFF until the data is ready, an error token otherwise
+    while(0xFFU == l_token && l_polls)
+    {
+        l_token = SPI_Transfer_data(SPI_DUMMY_BYTE);
+        l_polls--;
+    }
+    if(SD_CARD_TOKEN_START_BLOCK == l_token)
+    {
+        ret = SPI_Master_Transfer(NULL, NULL, buf, SD_CARD_BLOCK_SIZE);
+        ret &= SPI_Master_Transfer(NULL, NULL, l_crc, 2);
+#if SD_CARD_CFG_CRC==SD_CARD_CFG_FEATURE_ENABLE
+        if(sd_card_crc16(buf, SD_CARD_BLOCK_SIZE) != (uint16)(((uint16)l_crc[0] << 8) | l_crc[1]))
+        {
+            ret = E_NOT_OK;
+        }else{/* Nothing */}
+#endif
+    }
+    else
+    {
+        ret = E_NOT_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Helper function to send a data block and wait until the card has programmed it
+ */
+static Std_ReturnType sd_card_send_block(uint8 token, const uint8 *buf)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_crc[2] = {0xFFU, 0xFFU};
+#if SD_CARD_CFG_CRC==SD_CARD_CFG_FEATURE_ENABLE
+    uint16 l_crc16 = sd_card_crc16(buf, SD_CARD_BLOCK_SIZE);
+
+    l_crc[0] = (uint8)(l_crc16 >> 8);
+    l_crc[1] = (uint8)l_crc16;
+#endif
+    SPI_Transfer_data(token);
+    ret = SPI_Master_Transfer(NULL, buf, NULL, SD_CARD_BLOCK_SIZE);
+    ret &= SPI_Master_Transfer(NULL, l_crc, NULL, 2);
+    //Data response xxx0sss1, 010 accepted, then busy while programming
+    if(SD_CARD_DATA_ACCEPTED != (SPI_Transfer_data(SPI_DUMMY_BYTE) & SD_CARD_DATA_RESPONSE_MASK))
+    {
+        ret = E_NOT_OK;
+    }else{/* Nothing */}
+    ret &= sd_card_wait_ready(SD_CARD_WRITE_TIMEOUT_POLLS);
+    return ret;
+}
+
+/**
+ * @brief Helper function to read blocks from the card, the cache is left alone
+ */
+static Std_ReturnType sd_card_read_blocks(sd_card_t *card, uint32 sector, uint8 *buf, uint16 count)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_r1 = ZERO_INIT;
+    uint8 l_command = (1U == count) ? SD_CARD_CMD17_READ_SINGLE : SD_CARD_CMD18_READ_MULTIPLE;
+
+    //Standard capacity cards take a byte address
+    if(SD_CARD_TYPE_SDHC != card->type)
+    {
+        sector <<= 9;
+    }else{/* Nothing */}
+    ret = sd_card_select(card);
+    if(E_OK == ret)
+    {
+        ret = sd_card_command(l_command, sector, &l_r1);
+        if(ZERO_INIT != l_r1)
+        {
+            ret = E_NOT_OK;
+        }else{/* Nothing */}
+        while(E_OK == ret && count)
+        {
+            ret = sd_card_receive_block(buf);
+            buf += SD_CARD_BLOCK_SIZE;
+            count--;
+        }
+        if(SD_CARD_CMD18_READ_MULTIPLE == l_command)
+        {
+            ret &= sd_card_command(SD_CARD_CMD12_STOP, 0, &l_r1);
+            ret &= sd_card_wait_ready(SD_CARD_WRITE_TIMEOUT_POLLS);
+        }else{/* Nothing */}
+        sd_card_deselect(card);
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief Helper function to write blocks to the card, the cache is left alone
+ */
+static Std_ReturnType sd_card_write_blocks(sd_card_t *card, uint32 sector, const uint8 *buf, uint16 count)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_r1 = ZERO_INIT;
+    uint8 l_multiple = (uint8)(1U != count);
+
+    if(SD_CARD_TYPE_SDHC != card->type)
+    {
+        sector <<= 9;
+    }else{/* Nothing */}
+    ret = sd_card_select(card);
+    if(E_OK == ret)
+    {
+        ret = sd_card_command(l_multiple ? SD_CARD_CMD25_WRITE_MULTIPLE : SD_CARD_CMD24_WRITE_SINGLE,
+                              sector, &l_r1);
+        if(ZERO_INIT != l_r1)
+        {
+            ret = E_NOT_OK;
+        }else{/* Nothing */}
+        while(E_OK == ret && count)
+        {
+            ret = sd_card_send_block(l_multiple ? SD_CARD_TOKEN_START_MULTI : SD_CARD_TOKEN_START_BLOCK, buf);
+            buf += SD_CARD_BLOCK_SIZE;
+            count--;
+        }
+        //The stop token is needed even after an error, the card waits for more blocks
+        if(l_multiple && ZERO_INIT == l_r1)
+        {
+            SPI_Transfer_data(SD_CARD_TOKEN_STOP_MULTI);
+            SPI_Transfer_data(SPI_DUMMY_BYTE);
+            ret &= sd_card_wait_ready(SD_CARD_WRITE_TIMEOUT_POLLS);
+        }else{/* Nothing */}
+        sd_card_deselect(card);
+    }else{/* Nothing */}
+    return ret;
+}
+
+#if SD_CARD_CFG_CRC==SD_CARD_CFG_FEATURE_ENABLE
+/**
+ * @brief Helper function to compute the CRC7 byte of a command frame (end bit included)
+ */
+static uint8 sd_card_crc7(const uint8 *data, uint8 len)
+{
+    uint8 l_crc = ZERO_INIT;
+    uint8 l_byte = ZERO_INIT;
+    uint8 l_bit = ZERO_INIT;
+
+    while(len)
+    {
+        l_byte = *data++;
+        for(l_bit = 0; l_bit < 8; l_bit++)
+        {
+            l_crc <<= 1;
+            if((l_byte ^ l_crc) & 0x80U)
+            {
+                l_crc ^= 0x09U;
+            }else{/* Nothing */}
+            l_byte <<= 1;
+        }
+        len--;
+    }
+    return (uint8)((l_crc << 1) | 0x01U);
+}
+
+/**
+ * @brief Helper function to compute the CRC16 of a data block
+ */
+static uint16 sd_card_crc16(const uint8 *data, uint16 len)
+{
+    uint16 l_crc = ZERO_INIT;
+
+    while(len)
+    {
+        l_crc = (uint16)((l_crc << 4) ^ sd_card_crc16_table[(uint8)(l_crc >> 12) ^ (*data >> 4)]);
+        l_crc = (uint16)((l_crc << 4) ^ sd_card_crc16_table[(uint8)(l_crc >> 12) ^ (*data & 0x0FU)]);
+        data++;
+        len--;
+    }
+    return l_crc;
+}
+#endif
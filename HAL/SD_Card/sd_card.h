@@ -0,0 +1,175 @@
+/*
+ * File:   sd_card.h
+ * Author: Mohamed Sameh
+ *
+ * SD/SDHC/MMC card in SPI mode, 512-byte blocks.
+ * The card is initialized at FOSC/64 (125 kHz at 8 MHz, within the 100-400 kHz the
+ * specification requires), then the bus runs at FOSC/4. All transfers are blocking,
+ * with poll-count timeouts. An optional single-sector write-back cache keeps the last
+ * sector used through sd_card_cache_get() in RAM.
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef SD_CARD_H
+#define	SD_CARD_H
+
+/* -------------- Includes -------------- */
+#include "../../MCAL/SPI/spi.h"
+#include "sd_card_cfg.h"
+
+/* -------------- Macro Declarations ------------- */
+#define SD_CARD_BLOCK_SIZE              512U
+
+//Commands
+#define SD_CARD_CMD0_GO_IDLE            0U
+#define SD_CARD_CMD1_SEND_OP_COND       1U
+#define SD_CARD_CMD8_SEND_IF_COND       8U
+#define SD_CARD_CMD12_STOP              12U
+#define SD_CARD_CMD16_SET_BLOCKLEN      16U
+#define SD_CARD_CMD17_READ_SINGLE       17U
+#define SD_CARD_CMD18_READ_MULTIPLE     18U
+#define SD_CARD_CMD24_WRITE_SINGLE      24U
+#define SD_CARD_CMD25_WRITE_MULTIPLE    25U
+#define SD_CARD_ACMD41_SD_SEND_OP_COND  41U
+#define SD_CARD_CMD55_APP_CMD           55U
+#define SD_CARD_CMD58_READ_OCR          58U
+#define SD_CARD_CMD59_CRC_ON_OFF        59U
+
+//R1 response bits
+#define SD_CARD_R1_IDLE                 0x01U
+#define SD_CARD_R1_ILLEGAL_COMMAND      0x04U
+//Data tokens
+#define SD_CARD_TOKEN_START_BLOCK       0xFEU   /* CMD17, CMD18, CMD24 */
+#define SD_CARD_TOKEN_START_MULTI       0xFCU   /* CMD25 */
+#define SD_CARD_TOKEN_STOP_MULTI        0xFDU   /* CMD25 */
+#define SD_CARD_DATA_RESPONSE_MASK      0x1FU
+#define SD_CARD_DATA_ACCEPTED           0x05U
+//OCR card capacity status: block addressing
+#define SD_CARD_OCR_CCS                 0x40U
+//CMD8 argument: 2.7-3.6 V and the check pattern echoed in R7
+#define SD_CARD_CMD8_ARGUMENT           0x000001AAUL
+//ACMD41 argument: host supports high capacity
+#define SD_CARD_ACMD41_HCS              0x40000000UL
+
+#define SD_CARD_R1_POLLS                10U     /* NCR is up to 8 bytes */
+#define SD_CARD_CMD0_RETRIES            10U
+#define SD_CARD_INIT_RETRIES            1000U   /* ACMD41 loop, about 1 s at FOSC/64 */
+//Timeouts in polled bytes (about 10 us each at FOSC/4)
+#define SD_CARD_READ_TIMEOUT_POLLS      20000U  /* Data token, 100 ms required */
+#define SD_CARD_WRITE_TIMEOUT_POLLS     60000U  /* Busy after a block, 500 ms required */
+
+#define SD_CARD_NO_SECTOR               0xFFFFFFFFUL
+//SSPM bits of SSPCON1, the clock rate of the device image
+#define SD_CARD_SSPM_MASK               0x0FU
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+/**
+ * @brief Card Types
+ */
+typedef enum
+{
+    SD_CARD_TYPE_NONE = 0,
+    SD_CARD_TYPE_MMC,
+    SD_CARD_TYPE_SD_V1,
+    SD_CARD_TYPE_SD_V2,             /* Standard capacity, byte addressing */
+    SD_CARD_TYPE_SDHC               /* High capacity, block addressing */
+}sd_card_type_t;
+
+/**
+ * @brief SD Card, filled by sd_card_init()
+ */
+typedef struct
+{
+    spi_device_t device;
+    sd_card_type_t type;
+#if SD_CARD_CFG_CACHE==SD_CARD_CFG_FEATURE_ENABLE
+    uint32 cache_sector;            /* Sector held by the cache, SD_CARD_NO_SECTOR if none */
+    uint8 cache_dirty : 1;          /* Modified since it was read */
+    uint8 cache_reserved : 7;
+    uint8 cache[SD_CARD_BLOCK_SIZE];
+#endif
+}sd_card_t;
+
+/* -------------- Functions Declarations --------------*/
+/**
+ * @brief Initializes the card: SPI mode entry, CMD0, CMD8, ACMD41 (CMD1 for MMC) and CMD58.
+ *
+ * SPI_Master_Init() must be called first.
+ *
+ * @param card A pointer to the card to fill.
+ * @param chip_select A pointer to the chip select pin.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: No card, unusable card, or timeout.
+ */
+Std_ReturnType sd_card_init(sd_card_t *card, const pin_config_t *chip_select);
+
+/**
+ * @brief Reads blocks, CMD17 for one block and CMD18 for several.
+ *
+ * @param card A pointer to the card.
+ * @param sector The first block number.
+ * @param buf A buffer of count * 512 bytes.
+ * @param count Number of blocks.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType sd_card_read(sd_card_t *card, uint32 sector, uint8 *buf, uint16 count);
+
+/**
+ * @brief Writes blocks, CMD24 for one block and CMD25 for several.
+ *
+ * A cached copy of a written sector is dropped.
+ *
+ * @param card A pointer to the card.
+ * @param sector The first block number.
+ * @param buf The data, count * 512 bytes.
+ * @param count Number of blocks.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType sd_card_write(sd_card_t *card, uint32 sector, const uint8 *buf, uint16 count);
+
+#if SD_CARD_CFG_CACHE==SD_CARD_CFG_FEATURE_ENABLE
+/**
+ * @brief Brings a sector into the cache and returns its address.
+ *
+ * A cache hit costs no card access. On a miss a dirty sector is written back first.
+ * Call sd_card_cache_mark_dirty() after modifying the data.
+ *
+ * @param card A pointer to the card.
+ * @param sector The block number.
+ * @param data A pointer to store the address of the cached sector.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType sd_card_cache_get(sd_card_t *card, uint32 sector, uint8 **data);
+
+/**
+ * @brief Marks the cached sector as modified, it is written back on a miss or a flush.
+ *
+ * @param card A pointer to the card.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: The cache is empty.
+ */
+Std_ReturnType sd_card_cache_mark_dirty(sd_card_t *card);
+
+/**
+ * @brief Writes the cached sector back if it was modified.
+ *
+ * @param card A pointer to the card.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType sd_card_cache_flush(sd_card_t *card);
+#endif
+
+#endif	/* SD_CARD_H */
@@ -0,0 +1,29 @@
+/* 
+ * File:   sd_card_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef SD_CARD_CFG_H
+#define	SD_CARD_CFG_H
+
+/* -------------- Includes -------------- */
+
+/* -------------- Macro Declarations ------------- */
+#define SD_CARD_CFG_FEATURE_ENABLE      1U
+#define SD_CARD_CFG_FEATURE_DISABLE     0U
+
+//CRC7 on commands and CRC16 on data blocks (CMD59), off by default in SPI mode.
+#define SD_CARD_CFG_CRC                 SD_CARD_CFG_FEATURE_DISABLE
+//Write-back single-sector cache (512 bytes of RAM per card).
+#define SD_CARD_CFG_CACHE               SD_CARD_CFG_FEATURE_ENABLE
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+
+/* -------------- Functions Declarations --------------*/
+
+
+#endif	/* SD_CARD_CFG_H */
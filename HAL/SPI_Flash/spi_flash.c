@@ -0,0 +1,363 @@
+/*
+ * File:   spi_flash.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+
+#include "spi_flash.h"
+
+static Std_ReturnType spi_flash_command(spi_flash_t *flash, uint8 command, uint32 address, uint8 header_len,
+                                        const uint8 *tx_buf, uint8 *rx_buf, uint16 len);
+static Std_ReturnType spi_flash_read_direct(spi_flash_t *flash, uint32 address, uint8 *buf, uint16 len);
+static Std_ReturnType spi_flash_write_enable(spi_flash_t *flash);
+
+/**
+ * @brief Initializes the flash: wakes it from power-down and reads its JEDEC ID.
+ *
+ * @param flash A pointer to the flash device to fill.
+ * @param _spi A pointer to the SPI configuration of the flash (mode, waveform, sample).
+ * @param chip_select A pointer to the chip select pin.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid arguments, no flash answered, or its capacity needs 32-bit addresses.
+ */
+Std_ReturnType spi_flash_init(spi_flash_t *flash, const spi_t *_spi, const pin_config_t *chip_select)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_id[3] = {0};
+
+    if(NULL == flash || NULL == _spi || NULL == chip_select)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        flash->cache_len = ZERO_INIT;
+        flash->write_pending = ZERO_INIT;
+        flash->size = ZERO_INIT;
+        ret = SPI_Device_Init(&flash->device, _spi, chip_select);
+        if(E_OK == ret)
+        {
+            //A chip left in deep power-down ignores everything else (wake-up takes 3 us)
+            ret = spi_flash_command(flash, SPI_FLASH_CMD_RELEASE_POWER_DOWN, 0, 1, NULL, NULL, 0);
+            __delay_us(5);
+            ret &= spi_flash_command(flash, SPI_FLASH_CMD_JEDEC_ID, 0, 1, NULL, l_id, 3);
+        }else{/* Nothing */}
+        flash->manufacturer_id = l_id[0];
+        flash->memory_type = l_id[1];
+        flash->capacity_code = l_id[2];
+        //No chip reads all zeros or all ones
+        if(E_OK != ret || 0x00U == l_id[0] || 0xFFU == l_id[0] ||
+           l_id[2] < 0x10U || l_id[2] > SPI_FLASH_MAX_CAPACITY_CODE)
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            flash->size = 1UL << l_id[2];
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads bytes from the flash.
+ *
+ * @param flash A pointer to the flash device.
+ * @param address The first byte address.
+ * @param buf A buffer to store the bytes.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Out of range, or a program or erase cycle is running.
+ */
+Std_ReturnType spi_flash_read(spi_flash_t *flash, uint32 address, uint8 *buf, uint16 len)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_busy = ZERO_INIT;
+    uint16 l_count = ZERO_INIT;
+    uint32 l_fill = ZERO_INIT;
+
+    if(NULL == flash || NULL == buf || address >= flash->size || len > (flash->size - address))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = spi_flash_busy(flash, &l_busy);
+        if(l_busy)
+        {
+            ret = E_NOT_OK;
+        }else{/* Nothing */}
+        while(E_OK == ret && len)
+        {
+            if(address >= flash->cache_address && (address - flash->cache_address) < flash->cache_len)
+            {
+                //Hit: copy what the cache holds
+                l_count = (uint16)(flash->cache_len - (uint8)(address - flash->cache_address));
+                if(l_count > len)
+                {
+                    l_count = len;
+                }else{/* Nothing */}
+                memcpy(buf, &flash->cache[address - flash->cache_address], l_count);
+            }
+            else if(len >= SPI_FLASH_CFG_CACHE_SIZE)
+            {
+                //Long read: stream into the caller buffer
+                l_count = len;
+                ret = spi_flash_read_direct(flash, address, buf, l_count);
+            }
+            else
+            {
+                //Short read: read ahead into the cache, the loop copies from it
+                l_count = 0;
+                l_fill = flash->size - address;
+                if(l_fill > SPI_FLASH_CFG_CACHE_SIZE)
+                {
+                    l_fill = SPI_FLASH_CFG_CACHE_SIZE;
+                }else{/* Nothing */}
+                flash->cache_len = ZERO_INIT;
+                ret = spi_flash_read_direct(flash, address, flash->cache, (uint16)l_fill);
+                if(E_OK == ret)
+                {
+                    flash->cache_address = address;
+                    flash->cache_len = (uint8)l_fill;
+                }else{/* Nothing */}
+            }
+            buf += l_count;
+            address += l_count;
+            len -= l_count;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Starts programming bytes, up to the end of the page holding the address.
+ *
+ * @param flash A pointer to the flash device.
+ * @param address The first byte address.
+ * @param buf The bytes to program.
+ * @param len Number of bytes.
+ * @param accepted A pointer to store the number of bytes sent (until the page boundary).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The program cycle was started.
+ *         - E_NOT_OK: Out of range, or the previous cycle is still running.
+ */
+Std_ReturnType spi_flash_program_start(spi_flash_t *flash, uint32 address, const uint8 *buf,
+                                       uint16 len, uint16 *accepted)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_busy = ZERO_INIT;
+    uint16 l_count = ZERO_INIT;
+
+    if(NULL == flash || NULL == buf || NULL == accepted || ZERO_INIT == len ||
+       address >= flash->size || len > (flash->size - address))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = spi_flash_busy(flash, &l_busy);
+        if(E_OK == ret && ZERO_INIT == l_busy)
+        {
+            //The chip wraps around inside the page, stop at its end
+            l_count = (uint16)(SPI_FLASH_PAGE_SIZE - (uint16)(address & (SPI_FLASH_PAGE_SIZE - 1U)));
+            if(l_count > len)
+            {
+                l_count = len;
+            }else{/* Nothing */}
+            flash->cache_len = ZERO_INIT;
+            ret = spi_flash_write_enable(flash);
+            ret &= spi_flash_command(flash, SPI_FLASH_CMD_PAGE_PROGRAM, address, 4, buf, NULL, l_count);
+            flash->write_pending = 1;
+            *accepted = l_count;
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Programs bytes across page boundaries, waiting for each page cycle.
+ *
+ * @param flash A pointer to the flash device.
+ * @param address The first byte address.
+ * @param buf The bytes to program.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType spi_flash_write(spi_flash_t *flash, uint32 address, const uint8 *buf, uint16 len)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_busy = 1;
+    uint16 l_accepted = ZERO_INIT;
+
+    if(NULL == flash || NULL == buf)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        while(E_OK == ret && len)
+        {
+            //Wait for the previous page
+            do
+            {
+                ret = spi_flash_busy(flash, &l_busy);
+            }while(E_OK == ret && l_busy);
+            if(E_OK == ret)
+            {
+                ret = spi_flash_program_start(flash, address, buf, len, &l_accepted);
+            }else{/* Nothing */}
+            if(E_OK == ret)
+            {
+                address += l_accepted;
+                buf += l_accepted;
+                len -= l_accepted;
+            }else{/* Nothing */}
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Starts erasing the sector or block holding the address, or the whole chip.
+ *
+ * @param flash A pointer to the flash device.
+ * @param size The erase size.
+ * @param address An address inside the area (ignored for the chip).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The erase cycle was started.
+ *         - E_NOT_OK: Out of range, or the previous cycle is still running.
+ */
+Std_ReturnType spi_flash_erase_start(spi_flash_t *flash, spi_flash_erase_t size, uint32 address)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_busy = ZERO_INIT;
+    uint8 l_command = ZERO_INIT;
+
+    if(NULL == flash || address >= flash->size)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        switch (size)
+        {
+            case SPI_FLASH_ERASE_SECTOR_4K:  l_command = SPI_FLASH_CMD_SECTOR_ERASE;  break;
+            case SPI_FLASH_ERASE_BLOCK_32K:  l_command = SPI_FLASH_CMD_BLOCK32_ERASE; break;
+            case SPI_FLASH_ERASE_BLOCK_64K:  l_command = SPI_FLASH_CMD_BLOCK64_ERASE; break;
+            case SPI_FLASH_ERASE_CHIP:       l_command = SPI_FLASH_CMD_CHIP_ERASE;    break;
+            default: ret = E_NOT_OK; break;
+        }
+        if(E_OK == ret)
+        {
+            ret = spi_flash_busy(flash, &l_busy);
+        }else{/* Nothing */}
+        if(E_OK == ret && ZERO_INIT == l_busy)
+        {
+            flash->cache_len = ZERO_INIT;
+            ret = spi_flash_write_enable(flash);
+            ret &= spi_flash_command(flash, l_command, address,
+                                     (SPI_FLASH_ERASE_CHIP == size) ? 1 : 4, NULL, NULL, 0);
+            flash->write_pending = 1;
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Reports whether a program or erase cycle is running.
+ *
+ * @param flash A pointer to the flash device.
+ * @param busy A pointer to store the state (1 while a cycle is running).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType spi_flash_busy(spi_flash_t *flash, uint8 *busy)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_status = ZERO_INIT;
+
+    if(NULL == flash || NULL == busy)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(ZERO_INIT == flash->write_pending)
+    {
+        *busy = ZERO_INIT;
+    }
+    else
+    {
+        ret = spi_flash_command(flash, SPI_FLASH_CMD_READ_STATUS, 0, 1, NULL, &l_status, 1);
+        *busy = (uint8)(l_status & SPI_FLASH_STATUS_BUSY);
+        if(E_OK == ret && ZERO_INIT == *busy)
+        {
+            flash->write_pending = ZERO_INIT;
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief Helper function to send an instruction and its data with the chip selected once
+ *
+ * header_len is 1 for the instruction alone, 4 with the 24-bit address and 5 with a dummy byte.
+ */
+static Std_ReturnType spi_flash_command(spi_flash_t *flash, uint8 command, uint32 address, uint8 header_len,
+                                        const uint8 *tx_buf, uint8 *rx_buf, uint16 len)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_header[5];
+
+    l_header[0] = command;
+    l_header[1] = (uint8)(address >> 16);
+    l_header[2] = (uint8)(address >> 8);
+    l_header[3] = (uint8)address;
+    l_header[4] = 0xFFU;
+    ret = SPI_Bus_Acquire(&flash->device);
+    if(E_OK == ret)
+    {
+        ret = gpio_pin_write(&flash->device.slave_select, GPIO_LOW);
+        ret &= SPI_Master_Transfer(NULL, l_header, NULL, header_len);
+        if(len)
+        {
+            ret &= SPI_Master_Transfer(NULL, tx_buf, rx_buf, len);
+        }else{/* Nothing */}
+        ret &= gpio_pin_write(&flash->device.slave_select, GPIO_HIGH);
+        ret &= SPI_Bus_Release();
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief Helper function to read into a buffer with a single read instruction
+ */
+static Std_ReturnType spi_flash_read_direct(spi_flash_t *flash, uint32 address, uint8 *buf, uint16 len)
+{
+#if SPI_FLASH_CFG_FAST_READ==SPI_FLASH_CFG_FEATURE_ENABLE
+    return spi_flash_command(flash, SPI_FLASH_CMD_FAST_READ, address, 5, NULL, buf, len);
+#else
+    return spi_flash_command(flash, SPI_FLASH_CMD_READ, address, 4, NULL, buf, len);
+#endif
+}
+
+/**
+ * @brief Helper function to set the write enable latch, cleared by the chip after each cycle
+ */
+static Std_ReturnType spi_flash_write_enable(spi_flash_t *flash)
+{
+    return spi_flash_command(flash, SPI_FLASH_CMD_WRITE_ENABLE, 0, 1, NULL, NULL, 0);
+}
@@ -0,0 +1,170 @@
+/*
+ * File:   spi_flash.h
+ * Author: Mohamed Sameh
+ *
+ * JEDEC SPI NOR flash (25-series: W25Q, SST25/26, MX25, AT25...) with 24-bit addresses.
+ * Reads stream straight into the caller buffer, short sequential reads are served from a
+ * read-ahead cache. Programming is split on 256-byte page boundaries, and program and
+ * erase cycles can be started without waiting for them (spi_flash_busy()).
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef SPI_FLASH_H
+#define	SPI_FLASH_H
+
+/* -------------- Includes -------------- */
+#include "../../MCAL/SPI/spi.h"
+#include "spi_flash_cfg.h"
+
+/* -------------- Macro Declarations ------------- */
+#if (SPI_FLASH_CFG_CACHE_SIZE < 4) || (SPI_FLASH_CFG_CACHE_SIZE > 128)
+#error "SPI_FLASH_CFG_CACHE_SIZE must be between 4 and 128"
+#endif
+
+//Instructions
+#define SPI_FLASH_CMD_WRITE_ENABLE      0x06U
+#define SPI_FLASH_CMD_READ_STATUS       0x05U
+#define SPI_FLASH_CMD_READ              0x03U
+#define SPI_FLASH_CMD_FAST_READ         0x0BU
+#define SPI_FLASH_CMD_PAGE_PROGRAM      0x02U
+#define SPI_FLASH_CMD_SECTOR_ERASE      0x20U
+#define SPI_FLASH_CMD_BLOCK32_ERASE     0x52U
+#define SPI_FLASH_CMD_BLOCK64_ERASE     0xD8U
+#define SPI_FLASH_CMD_CHIP_ERASE        0xC7U
+#define SPI_FLASH_CMD_JEDEC_ID          0x9FU
+#define SPI_FLASH_CMD_RELEASE_POWER_DOWN    0xABU
+
+//Status register bits
+#define SPI_FLASH_STATUS_BUSY           0x01U   /* WIP, a program or erase cycle is running */
+#define SPI_FLASH_STATUS_WEL            0x02U
+
+#define SPI_FLASH_PAGE_SIZE             256U
+#define SPI_FLASH_SECTOR_SIZE           4096UL
+//Largest capacity code with 24-bit addresses (16 MiB).
+#define SPI_FLASH_MAX_CAPACITY_CODE     0x18U
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+/**
+ * @brief Erase Sizes
+ */
+typedef enum
+{
+    SPI_FLASH_ERASE_SECTOR_4K = 0,
+    SPI_FLASH_ERASE_BLOCK_32K,
+    SPI_FLASH_ERASE_BLOCK_64K,
+    SPI_FLASH_ERASE_CHIP
+}spi_flash_erase_t;
+
+/**
+ * @brief SPI Flash Device, filled by spi_flash_init()
+ */
+typedef struct
+{
+    spi_device_t device;
+    uint8 manufacturer_id;          /* JEDEC ID bytes */
+    uint8 memory_type;
+    uint8 capacity_code;            /* Size is 2^capacity_code bytes */
+    uint8 write_pending : 1;        /* A program or erase cycle may still be running */
+    uint8 flash_reserved : 7;
+    uint32 size;                    /* Bytes */
+    uint32 cache_address;           /* Flash address of cache[0] */
+    uint8 cache_len;                /* Valid bytes in the cache, 0 when empty */
+    uint8 cache[SPI_FLASH_CFG_CACHE_SIZE];
+}spi_flash_t;
+
+/* -------------- Functions Declarations --------------*/
+/**
+ * @brief Initializes the flash: wakes it from power-down and reads its JEDEC ID.
+ *
+ * SPI_Master_Init() must be called first. The flash works in SPI mode 0 or 3.
+ *
+ * @param flash A pointer to the flash device to fill.
+ * @param _spi A pointer to the SPI configuration of the flash (mode, waveform, sample).
+ * @param chip_select A pointer to the chip select pin.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid arguments, no flash answered, or its capacity needs 32-bit addresses.
+ */
+Std_ReturnType spi_flash_init(spi_flash_t *flash, const spi_t *_spi, const pin_config_t *chip_select);
+
+/**
+ * @brief Reads bytes from the flash.
+ *
+ * Reads shorter than SPI_FLASH_CFG_CACHE_SIZE fill the cache from the requested address
+ * and the following reads are served from it while they stay within the cached bytes, so
+ * walking through records costs one flash command per cache line. Longer reads stream
+ * directly into the buffer with a single command.
+ *
+ * @param flash A pointer to the flash device.
+ * @param address The first byte address.
+ * @param buf A buffer to store the bytes.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Out of range, or a program or erase cycle is running.
+ */
+Std_ReturnType spi_flash_read(spi_flash_t *flash, uint32 address, uint8 *buf, uint16 len);
+
+/**
+ * @brief Starts programming bytes, up to the end of the page holding the address.
+ *
+ * Returns once the bytes are sent, the chip programs them on its own (about 1 ms).
+ * Programming only clears bits, the area must have been erased.
+ *
+ * @param flash A pointer to the flash device.
+ * @param address The first byte address.
+ * @param buf The bytes to program.
+ * @param len Number of bytes.
+ * @param accepted A pointer to store the number of bytes sent (until the page boundary).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The program cycle was started.
+ *         - E_NOT_OK: Out of range, or the previous cycle is still running.
+ */
+Std_ReturnType spi_flash_program_start(spi_flash_t *flash, uint32 address, const uint8 *buf,
+                                       uint16 len, uint16 *accepted);
+
+/**
+ * @brief Programs bytes across page boundaries, waiting for each page cycle.
+ *
+ * @param flash A pointer to the flash device.
+ * @param address The first byte address.
+ * @param buf The bytes to program.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType spi_flash_write(spi_flash_t *flash, uint32 address, const uint8 *buf, uint16 len);
+
+/**
+ * @brief Starts erasing the sector or block holding the address, or the whole chip.
+ *
+ * Returns at once, the erase takes from tens of milliseconds (sector) to seconds (chip).
+ *
+ * @param flash A pointer to the flash device.
+ * @param size The erase size.
+ * @param address An address inside the area (ignored for the chip).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The erase cycle was started.
+ *         - E_NOT_OK: Out of range, or the previous cycle is still running.
+ */
+Std_ReturnType spi_flash_erase_start(spi_flash_t *flash, spi_flash_erase_t size, uint32 address);
+
+/**
+ * @brief Reports whether a program or erase cycle is running.
+ *
+ * Only reads the status register when a cycle was started since the last check that
+ * found the chip idle.
+ *
+ * @param flash A pointer to the flash device.
+ * @param busy A pointer to store the state (1 while a cycle is running).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType spi_flash_busy(spi_flash_t *flash, uint8 *busy);
+
+#endif	/* SPI_FLASH_H */
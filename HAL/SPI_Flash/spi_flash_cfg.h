@@ -0,0 +1,29 @@
+/* 
+ * File:   spi_flash_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef SPI_FLASH_CFG_H
+#define	SPI_FLASH_CFG_H
+
+/* -------------- Includes -------------- */
+
+/* -------------- Macro Declarations ------------- */
+#define SPI_FLASH_CFG_FEATURE_ENABLE    1U
+#define SPI_FLASH_CFG_FEATURE_DISABLE   0U
+
+//FAST READ (0x0B, one dummy byte) instead of READ (0x03), needed above 33 MHz SCK on most parts.
+#define SPI_FLASH_CFG_FAST_READ         SPI_FLASH_CFG_FEATURE_ENABLE
+//Read-ahead cache in bytes, reads shorter than this are served from it (4 to 128).
+#define SPI_FLASH_CFG_CACHE_SIZE        32U
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+
+/* -------------- Functions Declarations --------------*/
+
+
+#endif	/* SPI_FLASH_CFG_H */
@@ -0,0 +1,310 @@
+/*
+ * File:   shift_register.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+
+#include "shift_register.h"
+
+static Std_ReturnType shift_reg_locate(const shift_reg_t *chain, uint8 output, uint8 *index, uint8 *mask);
+static void shift_reg_latched(shift_reg_t *chain);
+#if SPI_CFG_ASYNC==SPI_CFG_FEATURE_ENABLE
+static void shift_reg_complete(void *context);
+#endif
+
+/**
+ * @brief Initializes the chain with all the outputs low.
+ *
+ * @param chain A pointer to the chain to fill.
+ * @param latch A pointer to the latch pin (RCLK).
+ * @param output_enable A pointer to the output enable pin (OE), NULL when OE is tied low.
+ * @param chips Number of chips in the chain.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType shift_reg_init(shift_reg_t *chain, const pin_config_t *latch,
+                              const pin_config_t *output_enable, uint8 chips)
+{
+    Std_ReturnType ret = E_OK;
+    spi_t l_spi;
+
+    if(NULL == chain || NULL == latch || ZERO_INIT == chips || chips > SHIFT_REG_CFG_MAX_CHIPS)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        memset(chain->image, 0, sizeof(chain->image));
+        chain->chips = chips;
+        chain->busy = ZERO_INIT;
+        chain->dirty = 1;
+        chain->outputs_enabled = ZERO_INIT;
+        //The 74HC595 shifts on the rising edge of SRCLK, MSB first lands on QH
+        l_spi.mode = SPI_MASTER_FOSC_DIV_4;
+        l_spi.master_waveform = SPI_CLK_IDLE_LOW_TX_TRAILING_FALLING;
+        l_spi.master_sample = SPI_MASTER_SAMPLE_MIDDLE_CFG;
+        ret = SPI_Device_Init(&chain->device, &l_spi, latch);
+        if(NULL != output_enable)
+        {
+            //Outputs off until the first image is latched
+            chain->has_output_enable = 1;
+            chain->output_enable = *output_enable;
+            chain->output_enable.direction = GPIO_DIRECTION_OUTPUT;
+            chain->output_enable.logic = GPIO_HIGH;
+            ret &= gpio_pin_initialize(&chain->output_enable);
+        }
+        else
+        {
+            chain->has_output_enable = ZERO_INIT;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Sets an output in the image.
+ *
+ * @param chain A pointer to the chain.
+ * @param output The output number.
+ * @param logic The output level.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType shift_reg_write_pin(shift_reg_t *chain, uint8 output, logic_t logic)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_mask = ZERO_INIT;
+
+    ret = shift_reg_locate(chain, output, &l_index, &l_mask);
+    if(E_OK == ret)
+    {
+        if(GPIO_HIGH == logic)
+        {
+            chain->image[l_index] |= l_mask;
+        }
+        else
+        {
+            chain->image[l_index] &= (uint8)~l_mask;
+        }
+        chain->dirty = 1;
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief Toggles an output in the image.
+ *
+ * @param chain A pointer to the chain.
+ * @param output The output number.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType shift_reg_toggle_pin(shift_reg_t *chain, uint8 output)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_mask = ZERO_INIT;
+
+    ret = shift_reg_locate(chain, output, &l_index, &l_mask);
+    if(E_OK == ret)
+    {
+        chain->image[l_index] ^= l_mask;
+        chain->dirty = 1;
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief Reads an output from the image.
+ *
+ * @param chain A pointer to the chain.
+ * @param output The output number.
+ * @param logic A pointer to store the output level.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType shift_reg_read_pin(const shift_reg_t *chain, uint8 output, logic_t *logic)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_mask = ZERO_INIT;
+
+    if(NULL == logic)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = shift_reg_locate(chain, output, &l_index, &l_mask);
+        if(E_OK == ret)
+        {
+            *logic = (chain->image[l_index] & l_mask) ? GPIO_HIGH : GPIO_LOW;
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief Sets the 8 outputs of a chip in the image, bit n is pin Qn.
+ *
+ * @param chain A pointer to the chain.
+ * @param chip The chip number.
+ * @param value The output levels.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType shift_reg_write_chip(shift_reg_t *chain, uint8 chip, uint8 value)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_mask = ZERO_INIT;
+
+    if(chip >= SHIFT_REG_CFG_MAX_CHIPS)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = shift_reg_locate(chain, (uint8)(chip * SHIFT_REG_OUTPUTS_PER_CHIP), &l_index, &l_mask);
+        if(E_OK == ret && value != chain->image[l_index])
+        {
+            chain->image[l_index] = value;
+            chain->dirty = 1;
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief Shifts the image out and latches it, when it changed since the last flush.
+ *
+ * @param chain A pointer to the chain.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful, or there was nothing to do.
+ *         - E_NOT_OK: The bus is busy with asynchronous transactions.
+ */
+Std_ReturnType shift_reg_flush(shift_reg_t *chain)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == chain || chain->busy)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(chain->dirty)
+    {
+        //Cleared first, a change made during the transfer is flushed next time
+        chain->dirty = ZERO_INIT;
+        ret = SPI_Device_Transfer(&chain->device, chain->image, NULL, chain->chips);
+        if(E_OK == ret)
+        {
+            shift_reg_latched(chain);
+        }
+        else
+        {
+            chain->dirty = 1;
+        }
+    }
+    else
+    {
+        /* Nothing */
+    }
+    return ret;
+}
+
+#if SPI_CFG_ASYNC==SPI_CFG_FEATURE_ENABLE
+/**
+ * @brief Starts an asynchronous flush when the image changed, call it from a timer handler.
+ *
+ * @param chain A pointer to the chain.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful, or there was nothing to do.
+ *         - E_NOT_OK: The SPI queue is full.
+ */
+Std_ReturnType shift_reg_tick(shift_reg_t *chain)
+{
+    Std_ReturnType ret = E_OK;
+    spi_transaction_t l_transaction;
+
+    if(NULL == chain)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(chain->dirty && ZERO_INIT == chain->busy)
+    {
+        l_transaction.device = &chain->device;
+        l_transaction.tx_buf = chain->image;
+        l_transaction.rx_buf = NULL;
+        l_transaction.len = chain->chips;
+        l_transaction.SPI_CompleteHandler = shift_reg_complete;
+        l_transaction.context = chain;
+        chain->dirty = ZERO_INIT;
+        chain->busy = 1;
+        ret = SPI_Async_Submit(&l_transaction);
+        if(E_OK != ret)
+        {
+            chain->busy = ZERO_INIT;
+            chain->dirty = 1;
+        }else{/* Nothing */}
+    }
+    else
+    {
+        /* Nothing */
+    }
+    return ret;
+}
+#endif
+
+/**
+ * @brief Helper function to find the image byte and bit of an output
+ *
+ * The first byte shifted out ends up in the last chip, so chip 0 is the last image byte.
+ */
+static Std_ReturnType shift_reg_locate(const shift_reg_t *chain, uint8 output, uint8 *index, uint8 *mask)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_chip = (uint8)(output / SHIFT_REG_OUTPUTS_PER_CHIP);
+
+    if(NULL == chain || l_chip >= chain->chips)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *index = (uint8)(chain->chips - 1U - l_chip);
+        *mask = (uint8)(1U << (output % SHIFT_REG_OUTPUTS_PER_CHIP));
+    }
+    return ret;
+}
+
+/**
+ * @brief Helper function to enable the outputs once a first image is latched
+ */
+static void shift_reg_latched(shift_reg_t *chain)
+{
+    if(chain->has_output_enable && ZERO_INIT == chain->outputs_enabled)
+    {
+        chain->outputs_enabled = 1;
+        gpio_pin_write(&chain->output_enable, GPIO_LOW);
+    }else{/* Nothing */}
+}
+
+#if SPI_CFG_ASYNC==SPI_CFG_FEATURE_ENABLE
+/**
+ * @brief The latch pulse ended the transfer, SPI_ISR() context
+ */
+static void shift_reg_complete(void *context)
+{
+    shift_reg_t *l_chain = (shift_reg_t *)context;
+
+    shift_reg_latched(l_chain);
+    l_chain->busy = ZERO_INIT;
+}
+#endif
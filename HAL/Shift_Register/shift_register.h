@@ -0,0 +1,147 @@
+/*
+ * File:   shift_register.h
+ * Author: Mohamed Sameh
+ *
+ * 74HC595 output expanders daisy-chained on the SPI bus (SDO to SER, SCK to SRCLK, QH' to
+ * the SER of the next chip). The outputs are kept in a RAM image, setting them only marks
+ * the image dirty. A flush shifts the whole chain out in one SPI block transfer, with the
+ * latch pin (RCLK) used as the slave select: it is low during the transfer and its rising
+ * edge at the end copies the shifted bits to all the outputs at once.
+ *
+ * Output n is pin Q(n % 8) of chip n / 8, chip 0 being the one wired to the PIC.
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef SHIFT_REGISTER_H
+#define	SHIFT_REGISTER_H
+
+/* -------------- Includes -------------- */
+#include "../../MCAL/SPI/spi.h"
+#include "shift_register_cfg.h"
+
+/* -------------- Macro Declarations ------------- */
+#if (SHIFT_REG_CFG_MAX_CHIPS < 1) || (SHIFT_REG_CFG_MAX_CHIPS > 32)
+#error "SHIFT_REG_CFG_MAX_CHIPS must be between 1 and 32"
+#endif
+
+#define SHIFT_REG_OUTPUTS_PER_CHIP      8U
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+/**
+ * @brief Shift Register Chain, filled by shift_reg_init()
+ */
+typedef struct
+{
+    spi_device_t device;                /* The slave select is the latch pin */
+    pin_config_t output_enable;         /* OE, active low */
+    uint8 has_output_enable : 1;
+    uint8 outputs_enabled : 1;          /* OE is released after the first flush */
+    uint8 shift_reg_reserved : 6;
+    uint8 chips;
+    volatile uint8 dirty;               /* The image differs from the outputs */
+    volatile uint8 busy;                /* An asynchronous flush is running */
+    uint8 image[SHIFT_REG_CFG_MAX_CHIPS];   /* In shifting order, the last chip first */
+}shift_reg_t;
+
+/* -------------- Functions Declarations --------------*/
+/**
+ * @brief Initializes the chain with all the outputs low.
+ *
+ * SPI_Master_Init() must be called first. The chain is clocked at FOSC/4 in SPI mode 0.
+ * With an OE pin the outputs stay disabled (high impedance) until the first flush, so the
+ * random power-up state of the chips never reaches the loads.
+ *
+ * @param chain A pointer to the chain to fill.
+ * @param latch A pointer to the latch pin (RCLK).
+ * @param output_enable A pointer to the output enable pin (OE), NULL when OE is tied low.
+ * @param chips Number of chips in the chain.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType shift_reg_init(shift_reg_t *chain, const pin_config_t *latch,
+                              const pin_config_t *output_enable, uint8 chips);
+
+/**
+ * @brief Sets an output in the image.
+ *
+ * @param chain A pointer to the chain.
+ * @param output The output number.
+ * @param logic The output level.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType shift_reg_write_pin(shift_reg_t *chain, uint8 output, logic_t logic);
+
+/**
+ * @brief Toggles an output in the image.
+ *
+ * @param chain A pointer to the chain.
+ * @param output The output number.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType shift_reg_toggle_pin(shift_reg_t *chain, uint8 output);
+
+/**
+ * @brief Reads an output from the image.
+ *
+ * @param chain A pointer to the chain.
+ * @param output The output number.
+ * @param logic A pointer to store the output level.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType shift_reg_read_pin(const shift_reg_t *chain, uint8 output, logic_t *logic);
+
+/**
+ * @brief Sets the 8 outputs of a chip in the image, bit n is pin Qn.
+ *
+ * @param chain A pointer to the chain.
+ * @param chip The chip number.
+ * @param value The output levels.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType shift_reg_write_chip(shift_reg_t *chain, uint8 chip, uint8 value);
+
+/**
+ * @brief Shifts the image out and latches it, when it changed since the last flush.
+ *
+ * @param chain A pointer to the chain.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful, or there was nothing to do.
+ *         - E_NOT_OK: The bus is busy with asynchronous transactions.
+ */
+Std_ReturnType shift_reg_flush(shift_reg_t *chain);
+
+#if SPI_CFG_ASYNC==SPI_CFG_FEATURE_ENABLE
+/**
+ * @brief Starts an asynchronous flush when the image changed, call it from a timer handler.
+ *
+ * The transfer runs in SPI_ISR() and the latch pulse ends it, the outputs then follow the
+ * image at the timer rate with no work in the main loop. Changes made while a transfer is
+ * running go out on the next tick.
+ *
+ * A tick during a blocking transfer on the same bus (SD card, SPI flash) only queues the
+ * flush, it starts when the blocking driver releases the bus (SPI_Bus_Release()).
+ * SPI_Async_Submit() may be called from both interrupt priorities, but the busy and dirty
+ * flags of the chain aren't protected: tick a chain from a single interrupt priority, and
+ * don't call shift_reg_flush() on a chain that is ticked.
+ *
+ * @param chain A pointer to the chain.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful, or there was nothing to do.
+ *         - E_NOT_OK: The SPI queue is full.
+ */
+Std_ReturnType shift_reg_tick(shift_reg_t *chain);
+#endif
+
+#endif	/* SHIFT_REGISTER_H */
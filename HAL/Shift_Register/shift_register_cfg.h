@@ -0,0 +1,24 @@
+/*
+ * File:   shift_register_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef SHIFT_REGISTER_CFG_H
+#define	SHIFT_REGISTER_CFG_H
+
+/* -------------- Includes -------------- */
+
+/* -------------- Macro Declarations ------------- */
+//Largest daisy chain, one image byte per chip.
+#define SHIFT_REG_CFG_MAX_CHIPS         4U
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+
+/* -------------- Functions Declarations --------------*/
+
+
+#endif	/* SHIFT_REGISTER_CFG_H */
@@ -11,6 +11,48 @@ static void (*ADC_InterruptHandler)(void) = NULL;
 static inline void ADC_Input_Channel_Pin_Config(adc_channel_t channel);
 static inline void ADC_Select_Result_Format(const adc_config_t *adc);
 static inline void ADC_Select_Volt_Ref(const adc_config_t *adc);
+static inline uint16 ADC_Read_Result_Registers(void);
+
+#if ADC_CFG_TRIGGERED_SAMPLING==ADC_CFG_FEATURE_ENABLE
+static volatile uint16 adc_sample_buffer[ADC_CFG_SAMPLE_BUFFER_SIZE];
+//Free running indexes, written by ADC_ISR() (head) and the reader (tail) only.
+static volatile uint8 adc_sample_head = ZERO_INIT;
+static volatile uint8 adc_sample_tail = ZERO_INIT;
+static volatile uint32 adc_dropped_samples = ZERO_INIT;
+static volatile uint8 adc_sampling_running = ZERO_INIT;
+
+static inline void ADC_Sample_Buffer_Push(uint16 sample);
+#endif
+
+#if ADC_CFG_OVERSAMPLING==ADC_CFG_FEATURE_ENABLE
+static uint8 adc_os_bits[ADC_CHANNEL_COUNT];
+static uint32 adc_os_sum[ADC_CHANNEL_COUNT];
+static uint16 adc_os_count[ADC_CHANNEL_COUNT];
+
+static inline uint8 ADC_Oversampling_Accumulate(uint8 channel, uint16 *sample);
+#endif
+
+#if ADC_CFG_FILTERS==ADC_CFG_FEATURE_ENABLE
+static adc_filter_t *adc_channel_filter[ADC_CHANNEL_COUNT];
+#endif
+
+#if ADC_CHANNEL_RESULTS==ADC_CFG_FEATURE_ENABLE
+static volatile uint16 adc_channel_result[ADC_CHANNEL_COUNT];
+static volatile uint16 adc_channel_ready = ZERO_INIT;   /* One bit per channel */
+#endif
+
+#if ADC_CFG_CONVERSION_PROFILES==ADC_CFG_FEATURE_ENABLE
+static uint8 adc_channel_profile[ADC_CHANNEL_COUNT];  /* @ref adc_profile_t */
+#endif
+
+#if ADC_CFG_WINDOW_COMPARATOR==ADC_CFG_FEATURE_ENABLE
+static adc_window_cfg_t adc_window[ADC_CHANNEL_COUNT];
+static volatile adc_window_state_t adc_window_state[ADC_CHANNEL_COUNT];
+static uint16 adc_window_armed = ZERO_INIT;             /* One bit per channel */
+static volatile uint16 adc_window_events = ZERO_INIT;   /* One bit per channel */
+
+static inline void ADC_Window_Evaluate(uint8 channel, uint16 value);
+#endif
 
 /**
  * @brief Initializes the ADC based on the provided configuration.
@@ -127,9 +169,53 @@ Std_ReturnType ADC_Select_Channel(const adc_config_t *adc, adc_channel_t channel
         //Change the default channel
         ADCON0bits.CHS = channel;
         ADC_Input_Channel_Pin_Config(channel);
+#if ADC_CFG_CONVERSION_PROFILES==ADC_CFG_FEATURE_ENABLE
+        //Apply the timing profile of the channel
+        if(channel < ADC_CHANNEL_COUNT && ADC_PROFILE_FAST == adc_channel_profile[channel])
+        {
+            ADCON2bits.ADCS = ADC_PROFILE_FAST_CLOCK;
+            ADCON2bits.ACQT = ADC_PROFILE_FAST_ACQ_TIME;
+        }
+        else if(channel < ADC_CHANNEL_COUNT && ADC_PROFILE_ACCURATE == adc_channel_profile[channel])
+        {
+            ADCON2bits.ADCS = ADC_PROFILE_ACCURATE_CLOCK;
+            ADCON2bits.ACQT = ADC_PROFILE_ACCURATE_ACQ_TIME;
+        }
+        else
+        {
+            ADCON2bits.ADCS = adc->clock;
+            ADCON2bits.ACQT = adc->acq_time;
+        }
+#endif
+    }
+    return ret;
+}
+
+#if ADC_CFG_CONVERSION_PROFILES==ADC_CFG_FEATURE_ENABLE
+/**
+ * @brief Assigns a conversion timing profile to a channel.
+ * 
+ * @param channel The channel.
+ * @param profile @ref adc_profile_t, ADC_PROFILE_CONFIG restores the adc_config_t timing.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid channel or profile.
+ */
+Std_ReturnType ADC_Profile_Set(adc_channel_t channel, adc_profile_t profile)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(channel >= ADC_CHANNEL_COUNT || profile > ADC_PROFILE_ACCURATE)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        adc_channel_profile[channel] = (uint8)profile;
     }
     return ret;
 }
+#endif
 
 /**
  * @brief Starts the ADC.
@@ -283,6 +369,521 @@ Std_ReturnType ADC_Start_Conversion_Interrupt(const adc_config_t *adc, adc_chann
     return ret;
 }
 
+#if ADC_CFG_TRIGGERED_SAMPLING==ADC_CFG_FEATURE_ENABLE
+/**
+ * @brief Starts hardware-paced sampling on the currently selected channel.
+ * 
+ * CCP2 is put in compare "special event trigger" mode on Timer1 or Timer3, so every
+ * compare match resets the timer and sets the GO bit in hardware. Every result is pushed
+ * by ADC_ISR() into the sampling ring buffer.
+ * 
+ * @param adc A pointer to the ADC configuration structure.
+ * @param trigger A pointer to the sampling configuration structure.
+ * @param achieved_rate A pointer to store the achieved sampling rate in Hz (can be NULL).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred or the rate can't be generated from _XTAL_FREQ.
+ */
+Std_ReturnType ADC_Triggered_Sampling_Start(const adc_config_t *adc, const adc_trigger_cfg_t *trigger,
+                                            uint32 *achieved_rate)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_timer_clock = _XTAL_FREQ / 4UL;
+    uint32 l_counts = ZERO_INIT;
+    uint8 l_prescaler = ZERO_INIT;
+    cpp_period_reg_t l_compare = {.ccprx_high = 0, .ccprx_low = 0};
+
+    if (NULL == adc || NULL == trigger || ZERO_INIT == trigger->sample_rate)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //Pick the smallest prescaler (1, 2, 4, 8) that fits the period in 16 bits
+        for(l_prescaler = 0; l_prescaler < 4; l_prescaler++)
+        {
+            l_counts = ((l_timer_clock >> l_prescaler) + (trigger->sample_rate / 2)) / trigger->sample_rate;
+            if(l_counts <= ADC_TRIGGER_MAX_COUNTS)
+            {
+                break;
+            }else{/* Nothing */}
+        }
+        if(l_prescaler > 3 || l_counts < 2)
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            ADC_Triggered_Sampling_Stop(adc);
+            adc_sample_head = ZERO_INIT;
+            adc_sample_tail = ZERO_INIT;
+            adc_dropped_samples = ZERO_INIT;
+            //The timer is reset on the match, so the period is CCPR2 + 1 counts
+            l_compare.ccprx_16Bits = (uint16)(l_counts - 1);
+            CCPR2L = l_compare.ccprx_low;
+            CCPR2H = l_compare.ccprx_high;
+            if(ADC_TRIGGER_TIMER1 == trigger->timer)
+            {
+                /* Timer1 is the compare clock source for the CCP modules */
+                T3CONbits.T3CCP1 = 0;
+                T3CONbits.T3CCP2 = 0;
+                T1CONbits.T1CKPS = l_prescaler;
+                TIMER1_TIMER_MODE_ENABLE();
+                TIMER1_16BITS_RW_ENABLE();
+                TMR1H = 0;
+                TMR1L = 0;
+                TIMER1_MODULE_ENABLE();
+            }
+            else
+            {
+                /* Timer3 is the compare clock source for CCP2, Timer1 for CCP1 */
+                T3CONbits.T3CCP1 = 1;
+                T3CONbits.T3CCP2 = 0;
+                T3CONbits.T3CKPS = l_prescaler;
+                TIMER3_TIMER_MODE_ENABLE();
+                TIMER3_16BITS_RW_ENABLE();
+                TMR3H = 0;
+                TMR3L = 0;
+                TIMER3_MODULE_ENABLE();
+            }
+            adc_sampling_running = 1;
+            ADC_INTERRUPT_FLAG_CLEAR();
+            ADC_INTERRUPT_ENABLE();
+            //Every compare match from now on starts a conversion
+            CCP2_SET_MODE(CCP_COMPARE_MODE_GEN_EVENT);
+            if(NULL != achieved_rate)
+            {
+                *achieved_rate = ((l_timer_clock >> l_prescaler) + (l_counts / 2)) / l_counts;
+            }else{/* Nothing */}
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Stops hardware-paced sampling and releases CCP2 and the timer.
+ * 
+ * @param adc A pointer to the ADC configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Triggered_Sampling_Stop(const adc_config_t *adc)
+{
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == adc)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(adc_sampling_running)
+        {
+            CCP2_SET_MODE(CCP_MODULE_DISABLE);
+            //Timer3 clocks CCP2 only when T3CCP1 is set
+            if(T3CONbits.T3CCP1)
+            {
+                TIMER3_MODULE_DISABLE();
+            }
+            else
+            {
+                TIMER1_MODULE_DISABLE();
+            }
+        }else{/* Nothing */}
+        adc_sampling_running = 0;
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads the oldest sample from the sampling ring buffer.
+ * 
+ * @param sample A pointer to store the sample.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: A sample was read.
+ *         - E_NOT_OK: The buffer is empty or the pointer is NULL.
+ */
+Std_ReturnType ADC_Triggered_Sampling_Read(uint16 *sample)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_tail = adc_sample_tail;
+
+    if (NULL == sample || adc_sample_head == l_tail)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *sample = adc_sample_buffer[l_tail & ADC_SAMPLE_BUFFER_MASK];
+        //Release the slot only after it has been copied
+        adc_sample_tail = (uint8)(l_tail + 1);
+    }
+    return ret;
+}
+
+/**
+ * @brief Reports how many samples are waiting and how many were dropped.
+ * 
+ * @param available A pointer to store the number of unread samples (can be NULL).
+ * @param dropped A pointer to store the number of dropped samples since start (can be NULL).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Triggered_Sampling_Status(uint8 *available, uint32 *dropped)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_adc_int_status = PIE1bits.ADIE;
+
+    if(NULL != available)
+    {
+        *available = (uint8)(adc_sample_head - adc_sample_tail);
+    }else{/* Nothing */}
+    if(NULL != dropped)
+    {
+        //The 32-bit counter is updated by ADC_ISR(), read it atomically
+        ADC_INTERRUPT_DISABLE();
+        *dropped = adc_dropped_samples;
+        PIE1bits.ADIE = l_adc_int_status;
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief Pushes a sample into the sampling ring buffer (ADC_ISR() context).
+ * 
+ * @param sample The sample to store.
+ */
+static inline void ADC_Sample_Buffer_Push(uint16 sample)
+{
+    uint8 l_head = adc_sample_head;
+
+    if((uint8)(l_head - adc_sample_tail) >= ADC_CFG_SAMPLE_BUFFER_SIZE)
+    {
+        adc_dropped_samples++;
+    }
+    else
+    {
+        adc_sample_buffer[l_head & ADC_SAMPLE_BUFFER_MASK] = sample;
+        adc_sample_head = (uint8)(l_head + 1);
+    }
+}
+#endif
+
+#if ADC_CFG_OVERSAMPLING==ADC_CFG_FEATURE_ENABLE
+/**
+ * @brief Sets the oversampling ratio of a channel.
+ * 
+ * Every output of a channel with n extra bits is the sum of 4^n conversions shifted right
+ * by n, accumulated as a running total in ADC_ISR().
+ * 
+ * @param channel The channel to configure.
+ * @param extra_bits @ref ADC_OVERSAMPLING_OFF to @ref ADC_OVERSAMPLING_14_BITS.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid channel or extra bits.
+ */
+Std_ReturnType ADC_Oversampling_Set(adc_channel_t channel, uint8 extra_bits)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_adc_int_status = PIE1bits.ADIE;
+
+    if(channel >= ADC_CHANNEL_COUNT || extra_bits > ADC_OVERSAMPLING_14_BITS)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ADC_INTERRUPT_DISABLE();
+        adc_os_bits[channel] = extra_bits;
+        adc_os_sum[channel] = ZERO_INIT;
+        adc_os_count[channel] = ZERO_INIT;
+        adc_channel_ready &= (uint16)~(1U << channel);
+        PIE1bits.ADIE = l_adc_int_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief Adds a conversion to the running sum of its channel (ADC_ISR() context).
+ * 
+ * @param channel The channel the conversion belongs to.
+ * @param sample The conversion, replaced by the decimated result when one is produced.
+ * @return uint8 1 when sample holds a result to forward, 0 while accumulating.
+ */
+static inline uint8 ADC_Oversampling_Accumulate(uint8 channel, uint16 *sample)
+{
+    uint8 l_ready = 1;
+    uint8 l_bits = ZERO_INIT;
+
+    if(channel < ADC_CHANNEL_COUNT && ADC_OVERSAMPLING_OFF != adc_os_bits[channel])
+    {
+        l_bits = adc_os_bits[channel];
+        adc_os_sum[channel] += *sample;
+        adc_os_count[channel]++;
+        //4^n conversions per output
+        if(adc_os_count[channel] >= (uint16)(1U << (l_bits << 1)))
+        {
+            *sample = (uint16)(adc_os_sum[channel] >> l_bits);
+            adc_os_sum[channel] = ZERO_INIT;
+            adc_os_count[channel] = ZERO_INIT;
+        }
+        else
+        {
+            l_ready = 0;
+        }
+    }else{/* Nothing */}
+    return l_ready;
+}
+#endif
+
+#if ADC_CFG_FILTERS==ADC_CFG_FEATURE_ENABLE
+/**
+ * @brief Attaches a filter to a channel, ADC_ISR() runs it on every result of the channel.
+ * 
+ * @param channel The channel to filter.
+ * @param filter A pointer to an initialized filter instance, or NULL to detach.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid channel.
+ */
+Std_ReturnType ADC_Filter_Attach(adc_channel_t channel, adc_filter_t *filter)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_adc_int_status = PIE1bits.ADIE;
+
+    if(channel >= ADC_CHANNEL_COUNT)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ADC_INTERRUPT_DISABLE();
+        if(NULL != filter)
+        {
+            //Start from the next result, no stale history
+            ADC_Filter_Reset(filter);
+        }else{/* Nothing */}
+        adc_channel_filter[channel] = filter;
+        PIE1bits.ADIE = l_adc_int_status;
+    }
+    return ret;
+}
+#endif
+
+#if ADC_CHANNEL_RESULTS==ADC_CFG_FEATURE_ENABLE
+/**
+ * @brief Retrieves the latest processed result of a channel.
+ * 
+ * @param channel The channel to read.
+ * @param adc_res A pointer to store the right justified result.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: A new result was read.
+ *         - E_NOT_OK: No new result since the last read, or invalid parameters.
+ */
+Std_ReturnType ADC_Get_Channel_Result(adc_channel_t channel, uint16 *adc_res)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_adc_int_status = PIE1bits.ADIE;
+
+    if(NULL == adc_res || channel >= ADC_CHANNEL_COUNT)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ADC_INTERRUPT_DISABLE();
+        if(adc_channel_ready & (1U << channel))
+        {
+            *adc_res = adc_channel_result[channel];
+            adc_channel_ready &= (uint16)~(1U << channel);
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+        PIE1bits.ADIE = l_adc_int_status;
+    }
+    return ret;
+}
+#endif
+
+#if ADC_CFG_WINDOW_COMPARATOR==ADC_CFG_FEATURE_ENABLE
+/**
+ * @brief Arms the window comparator of a channel.
+ * 
+ * @param channel The channel to watch.
+ * @param window A pointer to the window configuration, copied by the driver.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid channel, or low_threshold above high_threshold.
+ */
+Std_ReturnType ADC_Window_Set(adc_channel_t channel, const adc_window_cfg_t *window)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_adc_int_status = PIE1bits.ADIE;
+
+    if(NULL == window || channel >= ADC_CHANNEL_COUNT || window->low_threshold > window->high_threshold)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ADC_INTERRUPT_DISABLE();
+        adc_window[channel] = *window;
+        adc_window_state[channel] = ADC_WINDOW_INSIDE;
+        adc_window_events &= (uint16)~(1U << channel);
+        adc_window_armed |= (uint16)(1U << channel);
+        PIE1bits.ADIE = l_adc_int_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief Disarms the window comparator of a channel and clears its pending event.
+ * 
+ * @param channel The channel.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid channel.
+ */
+Std_ReturnType ADC_Window_Disable(adc_channel_t channel)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_adc_int_status = PIE1bits.ADIE;
+
+    if(channel >= ADC_CHANNEL_COUNT)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ADC_INTERRUPT_DISABLE();
+        adc_window_armed &= (uint16)~(1U << channel);
+        adc_window_events &= (uint16)~(1U << channel);
+        adc_window_state[channel] = ADC_WINDOW_INSIDE;
+        PIE1bits.ADIE = l_adc_int_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads the current window state of a channel.
+ * 
+ * @param channel The channel.
+ * @param state A pointer to store the state.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid parameters.
+ */
+Std_ReturnType ADC_Window_Get_State(adc_channel_t channel, adc_window_state_t *state)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == state || channel >= ADC_CHANNEL_COUNT)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *state = adc_window_state[channel];
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads and clears the pending crossing events.
+ * 
+ * @param events A pointer to store the event mask.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Window_Get_Events(uint16 *events)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_adc_int_status = PIE1bits.ADIE;
+
+    if(NULL == events)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ADC_INTERRUPT_DISABLE();
+        *events = adc_window_events;
+        adc_window_events = ZERO_INIT;
+        PIE1bits.ADIE = l_adc_int_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief Moves a channel through its window states (ADC_ISR() context).
+ * 
+ * @param channel The channel the result belongs to.
+ * @param value The processed result.
+ */
+static inline void ADC_Window_Evaluate(uint8 channel, uint16 value)
+{
+    adc_window_cfg_t *l_window = &adc_window[channel];
+    adc_window_state_t l_old = adc_window_state[channel];
+    adc_window_state_t l_new = l_old;
+
+    if(value > l_window->high_threshold)
+    {
+        l_new = ADC_WINDOW_ABOVE;
+    }
+    else if(value < l_window->low_threshold)
+    {
+        l_new = ADC_WINDOW_BELOW;
+    }
+    //Inside the thresholds but still within the hysteresis band, keep the old state
+    else if(ADC_WINDOW_ABOVE == l_old)
+    {
+        if((uint32)value + l_window->hysteresis <= l_window->high_threshold)
+        {
+            l_new = ADC_WINDOW_INSIDE;
+        }else{/* Nothing */}
+    }
+    else if(ADC_WINDOW_BELOW == l_old)
+    {
+        if((uint32)value >= (uint32)l_window->low_threshold + l_window->hysteresis)
+        {
+            l_new = ADC_WINDOW_INSIDE;
+        }else{/* Nothing */}
+    }else{/* Nothing */}
+
+    if(l_new != l_old)
+    {
+        adc_window_state[channel] = l_new;
+        adc_window_events |= (uint16)(1U << channel);
+        if(l_window->ADC_WindowHandler)
+        {
+            l_window->ADC_WindowHandler((adc_channel_t)channel, l_new, value);
+        }else{/* Nothing */}
+    }else{/* Nothing */}
+}
+#endif
+
+/**
+ * @brief Reads the result registers according to the selected result format.
+ * 
+ * @return uint16 The right justified 10-bit result.
+ */
+static inline uint16 ADC_Read_Result_Registers(void)
+{
+    uint16 l_res = (uint16)((ADRESH << 8) + ADRESL);
+
+    //ADFM is cleared for the left justified format
+    if(0 == ADCON2bits.ADFM)
+    {
+        l_res = (uint16)(l_res >> 6);
+    }else{/* Nothing */}
+    return l_res;
+}
+
 /**
  * @brief Selects channel as input 
  * 
@@ -356,12 +957,55 @@ static inline void ADC_Select_Volt_Ref(const adc_config_t *adc)
 void ADC_ISR(void)
 {
 #if ADC_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    uint16 l_sample = ZERO_INIT;
+    uint8 l_ready = 1;
+#if (ADC_CHANNEL_RESULTS==ADC_CFG_FEATURE_ENABLE) || (ADC_CFG_WINDOW_COMPARATOR==ADC_CFG_FEATURE_ENABLE)
+    uint8 l_channel = ADCON0bits.CHS;
+#endif
+
     //The ADC interrupt occurred, the flag must be cleared.
     ADC_INTERRUPT_FLAG_CLEAR();
-    /* Code */
+    l_sample = ADC_Read_Result_Registers();
+#if ADC_CFG_OVERSAMPLING==ADC_CFG_FEATURE_ENABLE
+    l_ready = ADC_Oversampling_Accumulate(l_channel, &l_sample);
+#if ADC_CFG_TRIGGERED_SAMPLING==ADC_CFG_FEATURE_ENABLE
+    if(0 == l_ready && 0 == adc_sampling_running)
+#else
+    if(0 == l_ready)
+#endif
+    {
+        //Software started block, convert again until 4^n samples are summed
+        ADC_START_CONV();
+    }else{/* Nothing */}
+#endif
+#if ADC_CFG_FILTERS==ADC_CFG_FEATURE_ENABLE
+    if(l_ready && l_channel < ADC_CHANNEL_COUNT && NULL != adc_channel_filter[l_channel])
+    {
+        ADC_Filter_Process(adc_channel_filter[l_channel], l_sample, &l_sample);
+    }else{/* Nothing */}
+#endif
+#if ADC_CHANNEL_RESULTS==ADC_CFG_FEATURE_ENABLE
+    if(l_ready && l_channel < ADC_CHANNEL_COUNT)
+    {
+        adc_channel_result[l_channel] = l_sample;
+        adc_channel_ready |= (uint16)(1U << l_channel);
+    }else{/* Nothing */}
+#endif
+#if ADC_CFG_WINDOW_COMPARATOR==ADC_CFG_FEATURE_ENABLE
+    if(l_ready && l_channel < ADC_CHANNEL_COUNT && (adc_window_armed & (1U << l_channel)))
+    {
+        ADC_Window_Evaluate(l_channel, l_sample);
+    }else{/* Nothing */}
+#endif
+#if ADC_CFG_TRIGGERED_SAMPLING==ADC_CFG_FEATURE_ENABLE
+    if(l_ready && adc_sampling_running)
+    {
+        ADC_Sample_Buffer_Push(l_sample);
+    }else{/* Nothing */}
+#endif
 
-    //CallBack func gets called every time this ISR executes.
-    if(ADC_InterruptHandler)
+    //CallBack func gets called every time a result is ready.
+    if(l_ready && ADC_InterruptHandler)
     {
         ADC_InterruptHandler();
     }
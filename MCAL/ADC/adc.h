@@ -12,6 +12,14 @@
 #include "../GPIO/gpio.h"
 #include "../interrupt/internal_interrupt.h"
 #include "adc_cfg.h"
+#if ADC_CFG_TRIGGERED_SAMPLING==ADC_CFG_FEATURE_ENABLE
+#include "../CCP/ccp.h"
+#include "../TIMER1/timer1.h"
+#include "../TIMER3/timer3.h"
+#endif
+#if ADC_CFG_FILTERS==ADC_CFG_FEATURE_ENABLE
+#include "adc_filter.h"
+#endif
 
 /* -------------- Macro Declarations ------------- */
 /**
@@ -39,6 +47,73 @@
 #define ADC_VOLT_REF_ENABLE   0x01U
 #define ADC_VOLT_REF_DISABLE  0x00U
 
+//Number of analog input channels (AN0 to AN12).
+#define ADC_CHANNEL_COUNT     13U
+
+#if ADC_CFG_TRIGGERED_SAMPLING==ADC_CFG_FEATURE_ENABLE
+#if ADC_INTERRUPT_ENABLE_FEATURE!=INTERRUPT_FEATURE_ENABLE
+#error "ADC triggered sampling needs ADC_INTERRUPT_ENABLE_FEATURE"
+#endif
+#if (ADC_CFG_SAMPLE_BUFFER_SIZE < 2) || (ADC_CFG_SAMPLE_BUFFER_SIZE > 128) || \
+    (ADC_CFG_SAMPLE_BUFFER_SIZE & (ADC_CFG_SAMPLE_BUFFER_SIZE - 1))
+#error "ADC_CFG_SAMPLE_BUFFER_SIZE must be a power of two between 2 and 128"
+#endif
+#define ADC_SAMPLE_BUFFER_MASK      (ADC_CFG_SAMPLE_BUFFER_SIZE - 1U)
+//Largest count between two special events (16-bit timer).
+#define ADC_TRIGGER_MAX_COUNTS      65536UL
+#endif
+
+#if ADC_CFG_OVERSAMPLING==ADC_CFG_FEATURE_ENABLE
+#if ADC_INTERRUPT_ENABLE_FEATURE!=INTERRUPT_FEATURE_ENABLE
+#error "ADC oversampling needs ADC_INTERRUPT_ENABLE_FEATURE"
+#endif
+//Extra result bits gained by oversampling (10-bit result + n bits).
+#define ADC_OVERSAMPLING_OFF            0U
+#define ADC_OVERSAMPLING_11_BITS        1U
+#define ADC_OVERSAMPLING_12_BITS        2U
+#define ADC_OVERSAMPLING_13_BITS        3U
+#define ADC_OVERSAMPLING_14_BITS        4U
+#endif
+
+#if ADC_CFG_FILTERS==ADC_CFG_FEATURE_ENABLE
+#if ADC_INTERRUPT_ENABLE_FEATURE!=INTERRUPT_FEATURE_ENABLE
+#error "ADC filters need ADC_INTERRUPT_ENABLE_FEATURE"
+#endif
+#endif
+
+#if ADC_CFG_WINDOW_COMPARATOR==ADC_CFG_FEATURE_ENABLE
+#if ADC_INTERRUPT_ENABLE_FEATURE!=INTERRUPT_FEATURE_ENABLE
+#error "ADC window comparator needs ADC_INTERRUPT_ENABLE_FEATURE"
+#endif
+#endif
+
+/**
+ * @brief Conversion timing limits (PIC18F4620 datasheet, A/D converter characteristics)
+ * @note  ADC_FRC_TAD_NS is the typical internal RC period, only used for the rate report.
+ */
+#define ADC_TAD_MIN_NS                  700UL
+#define ADC_TAD_MAX_NS                  25000UL
+#define ADC_FRC_TAD_NS                  2500UL
+//A conversion takes 11 TAD plus 2 TAD before the next acquisition can start.
+#define ADC_CONVERSION_TADS             13UL
+
+/**
+ * @brief Minimum acquisition time: TACQ = TAMP + TC + TCOFF
+ *        TAMP  = 200 ns
+ *        TCOFF = (Temp - 25 C) * 20 ns/C
+ *        TC    = CHOLD * (RIC + RSS + RS) * ln(2048), CHOLD = 25 pF, RIC + RSS = 3 kOhm,
+ *                25 pF * ln(2048) = 0.190625 ns/Ohm = 61/320 ns/Ohm
+ */
+#define ADC_ACQUISITION_NS              (200UL + ((ADC_CFG_MAX_TEMPERATURE_C - 25UL) * 20UL) + \
+                                         (((3000UL + ADC_CFG_SOURCE_IMPEDANCE_OHMS) * 61UL + 319UL) / 320UL))
+
+//ADC_ISR() keeps the latest processed result of every channel.
+#if (ADC_CFG_OVERSAMPLING==ADC_CFG_FEATURE_ENABLE) || (ADC_CFG_FILTERS==ADC_CFG_FEATURE_ENABLE)
+#define ADC_CHANNEL_RESULTS             ADC_CFG_FEATURE_ENABLE
+#else
+#define ADC_CHANNEL_RESULTS             ADC_CFG_FEATURE_DISABLE
+#endif
+
 /* -------------- Macro Functions Declarations --------------*/
 
 //A/D conversion cycle in progress or A/D conversion completed/not in progress
@@ -77,6 +152,73 @@
 #define ADC_RESULT_RIGHT_FORMAT()   (ADCON2bits.ADFM = 1) 
 #define ADC_RESULT_LEFT_FORMAT()    (ADCON2bits.ADFM = 0)
  
+/**
+ * @brief Compile-time conversion timing selection
+ * 
+ * ADC_SELECT_CLOCK_DIV(min TAD) picks the smallest Fosc divisor giving TAD >= min TAD,
+ * 0 stands for the internal RC clock when no divisor stays under ADC_TAD_MAX_NS.
+ * ADC_SELECT_ACQ_TADS(min TACQ, TAD) picks the shortest ACQT (2 to 20 TAD) covering TACQ,
+ * 0 means ACQT can't cover it. The *_CODE() macros give the ADCS/ACQT register values,
+ * so every result is usable in #if as well as in an adc_config_t initializer.
+ */
+#define ADC_TAD_NS(_DIV)                (((_DIV) * 1000000UL) / (_XTAL_FREQ / 1000UL))
+#define ADC_SELECT_CLOCK_DIV_RAW(_NS)   ((ADC_TAD_NS(2UL) >= (_NS)) ? 2UL : \
+                                         (ADC_TAD_NS(4UL) >= (_NS)) ? 4UL : \
+                                         (ADC_TAD_NS(8UL) >= (_NS)) ? 8UL : \
+                                         (ADC_TAD_NS(16UL) >= (_NS)) ? 16UL : \
+                                         (ADC_TAD_NS(32UL) >= (_NS)) ? 32UL : 64UL)
+#define ADC_SELECT_CLOCK_DIV(_NS)       ((ADC_TAD_NS(ADC_SELECT_CLOCK_DIV_RAW(_NS)) > ADC_TAD_MAX_NS) ? \
+                                         0UL : ADC_SELECT_CLOCK_DIV_RAW(_NS))
+#define ADC_CLOCK_DIV_TAD_NS(_DIV)      ((0UL == (_DIV)) ? ADC_FRC_TAD_NS : ADC_TAD_NS(_DIV))
+#define ADC_CLOCK_DIV_CODE(_DIV)        ((2UL == (_DIV)) ? 0U : (4UL == (_DIV)) ? 4U : \
+                                         (8UL == (_DIV)) ? 1U : (16UL == (_DIV)) ? 5U : \
+                                         (32UL == (_DIV)) ? 2U : (64UL == (_DIV)) ? 6U : 3U)
+
+#define ADC_SELECT_ACQ_TADS(_ACQ_NS, _TAD_NS) \
+                                        (((2UL * (_TAD_NS)) >= (_ACQ_NS)) ? 2UL : \
+                                         ((4UL * (_TAD_NS)) >= (_ACQ_NS)) ? 4UL : \
+                                         ((6UL * (_TAD_NS)) >= (_ACQ_NS)) ? 6UL : \
+                                         ((8UL * (_TAD_NS)) >= (_ACQ_NS)) ? 8UL : \
+                                         ((12UL * (_TAD_NS)) >= (_ACQ_NS)) ? 12UL : \
+                                         ((16UL * (_TAD_NS)) >= (_ACQ_NS)) ? 16UL : \
+                                         ((20UL * (_TAD_NS)) >= (_ACQ_NS)) ? 20UL : 0UL)
+#define ADC_ACQ_TADS_CODE(_TADS)        ((2UL == (_TADS)) ? 1U : (4UL == (_TADS)) ? 2U : \
+                                         (6UL == (_TADS)) ? 3U : (8UL == (_TADS)) ? 4U : \
+                                         (12UL == (_TADS)) ? 5U : (16UL == (_TADS)) ? 6U : 7U)
+
+//Back to back conversions per second for a divisor and an ACQT length.
+#define ADC_CONVERSIONS_PER_SEC(_DIV, _TADS) \
+                                        (1000000000UL / (((_TADS) + ADC_CONVERSION_TADS) * ADC_CLOCK_DIV_TAD_NS(_DIV)))
+
+/**
+ * @brief Fast profile: shortest legal TAD and acquisition time for ADC_CFG_SOURCE_IMPEDANCE_OHMS.
+ *        Accurate profile: TAD and acquisition time at least doubled, for margin on
+ *        high-impedance or slowly settling sources and a quieter conversion.
+ * @note  ADC_PROFILE_FAST_CLOCK / ADC_PROFILE_FAST_ACQ_TIME can be used directly in an
+ *        adc_config_t initializer: .clock = ADC_PROFILE_FAST_CLOCK
+ */
+#define ADC_PROFILE_FAST_DIV            ADC_SELECT_CLOCK_DIV(ADC_TAD_MIN_NS)
+#define ADC_PROFILE_FAST_TADS           ADC_SELECT_ACQ_TADS(ADC_ACQUISITION_NS, \
+                                            ADC_CLOCK_DIV_TAD_NS(ADC_PROFILE_FAST_DIV))
+#define ADC_PROFILE_FAST_CLOCK          ((adc_conversion_clock_t)ADC_CLOCK_DIV_CODE(ADC_PROFILE_FAST_DIV))
+#define ADC_PROFILE_FAST_ACQ_TIME       ((adc_acq_time_t)ADC_ACQ_TADS_CODE(ADC_PROFILE_FAST_TADS))
+#define ADC_PROFILE_FAST_CONV_PER_SEC   ADC_CONVERSIONS_PER_SEC(ADC_PROFILE_FAST_DIV, ADC_PROFILE_FAST_TADS)
+
+#define ADC_PROFILE_ACCURATE_DIV        ADC_SELECT_CLOCK_DIV(2UL * ADC_CLOCK_DIV_TAD_NS(ADC_PROFILE_FAST_DIV))
+#define ADC_PROFILE_ACCURATE_TADS       ADC_SELECT_ACQ_TADS(2UL * ADC_ACQUISITION_NS, \
+                                            ADC_CLOCK_DIV_TAD_NS(ADC_PROFILE_ACCURATE_DIV))
+#define ADC_PROFILE_ACCURATE_CLOCK      ((adc_conversion_clock_t)ADC_CLOCK_DIV_CODE(ADC_PROFILE_ACCURATE_DIV))
+#define ADC_PROFILE_ACCURATE_ACQ_TIME   ((adc_acq_time_t)ADC_ACQ_TADS_CODE(ADC_PROFILE_ACCURATE_TADS))
+#define ADC_PROFILE_ACCURATE_CONV_PER_SEC \
+                                        ADC_CONVERSIONS_PER_SEC(ADC_PROFILE_ACCURATE_DIV, ADC_PROFILE_ACCURATE_TADS)
+
+#if 0UL == ADC_PROFILE_FAST_TADS
+#error "ADC_CFG_SOURCE_IMPEDANCE_OHMS needs more than 20 TAD of acquisition time"
+#endif
+#if 0UL == ADC_PROFILE_ACCURATE_TADS
+#error "ADC_CFG_SOURCE_IMPEDANCE_OHMS needs more than 20 TAD of acquisition time in the accurate profile"
+#endif
+
 /* -------------- Data Types Declarations --------------  */
 /**
  * @brief ADC Digital Result Foramt 
@@ -161,6 +303,70 @@ typedef struct
     uint8 volt_reference : 1;       /* Voltage Reference Configuration */
 }adc_config_t;
 
+#if ADC_CFG_CONVERSION_PROFILES==ADC_CFG_FEATURE_ENABLE
+/**
+ * @brief Per-channel conversion timing profile
+ * 
+ */
+typedef enum
+{
+    ADC_PROFILE_CONFIG = 0,         /* Clock and acquisition time from adc_config_t */
+    ADC_PROFILE_FAST,
+    ADC_PROFILE_ACCURATE
+}adc_profile_t;
+#endif
+
+#if ADC_CFG_TRIGGERED_SAMPLING==ADC_CFG_FEATURE_ENABLE
+/**
+ * @brief Time base of the CCP2 special event trigger
+ * 
+ */
+typedef enum
+{
+    ADC_TRIGGER_TIMER1 = 0,
+    ADC_TRIGGER_TIMER3
+}adc_trigger_timer_t;
+
+/**
+ * @brief Hardware-Paced Sampling Configuration Structure
+ * 
+ */
+typedef struct
+{
+    uint32 sample_rate;             /* Requested sampling rate in Hz */
+    adc_trigger_timer_t timer;      /* @ref adc_trigger_timer_t */
+}adc_trigger_cfg_t;
+#endif
+
+#if ADC_CFG_WINDOW_COMPARATOR==ADC_CFG_FEATURE_ENABLE
+/**
+ * @brief Position of a channel result relative to its window
+ * 
+ */
+typedef enum
+{
+    ADC_WINDOW_INSIDE = 0,
+    ADC_WINDOW_ABOVE,
+    ADC_WINDOW_BELOW
+}adc_window_state_t;
+
+/**
+ * @brief Window Comparator Configuration Structure
+ * 
+ * A result above high_threshold enters ADC_WINDOW_ABOVE and it takes a result at or below
+ * (high_threshold - hysteresis) to return inside; a result below low_threshold enters
+ * ADC_WINDOW_BELOW and it takes a result at or above (low_threshold + hysteresis) to return.
+ */
+typedef struct
+{
+    uint16 low_threshold;
+    uint16 high_threshold;
+    uint16 hysteresis;
+    /* Called from ADC_ISR() on every crossing (can be NULL) */
+    void (*ADC_WindowHandler)(adc_channel_t channel, adc_window_state_t state, uint16 value);
+}adc_window_cfg_t;
+#endif
+
 /* -------------- Functions Declarations --------------*/
 /**
  * @brief Initializes the ADC based on the provided configuration.
@@ -198,6 +404,26 @@ Std_ReturnType ADC_DeInit(const adc_config_t *adc);
  */
 Std_ReturnType ADC_Select_Channel(const adc_config_t *adc, adc_channel_t channel);
 
+#if ADC_CFG_CONVERSION_PROFILES==ADC_CFG_FEATURE_ENABLE
+/**
+ * @brief Assigns a conversion timing profile to a channel.
+ * 
+ * The profile's ADCS/ACQT values are written by ADC_Select_Channel() every time the
+ * channel is selected, so a scan can mix fast channels with slow high-impedance ones.
+ * 
+ *   profile  | ADCS / ACQT                                   | conversions per second
+ *   FAST     | ADC_PROFILE_FAST_CLOCK / _FAST_ACQ_TIME         | ADC_PROFILE_FAST_CONV_PER_SEC
+ *   ACCURATE | ADC_PROFILE_ACCURATE_CLOCK / _ACCURATE_ACQ_TIME | ADC_PROFILE_ACCURATE_CONV_PER_SEC
+ * 
+ * @param channel The channel.
+ * @param profile @ref adc_profile_t, ADC_PROFILE_CONFIG restores the adc_config_t timing.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid channel or profile.
+ */
+Std_ReturnType ADC_Profile_Set(adc_channel_t channel, adc_profile_t profile);
+#endif
+
 /**
  * @brief Starts the ADC.
  * 
@@ -262,5 +488,179 @@ Std_ReturnType ADC_Get_Conversion_Blocking(const adc_config_t *adc, adc_channel_
  */
 Std_ReturnType ADC_Start_Conversion_Interrupt(const adc_config_t *adc, adc_channel_t channel);
 
+#if ADC_CFG_TRIGGERED_SAMPLING==ADC_CFG_FEATURE_ENABLE
+/**
+ * @brief Starts hardware-paced sampling on the currently selected channel.
+ * 
+ * CCP2 is put in compare "special event trigger" mode on Timer1 or Timer3, so every
+ * compare match resets the timer and sets the GO bit in hardware. The sampling period
+ * does not depend on the main loop at all. Every result is pushed by ADC_ISR() into a
+ * ring buffer of ADC_CFG_SAMPLE_BUFFER_SIZE samples; when it is full the new sample is
+ * dropped and counted.
+ * 
+ * The compare value is computed from _XTAL_FREQ with the smallest timer prescaler that
+ * fits the period in 16 bits, which keeps the rate error as small as possible.
+ * 
+ * @note CCP2 and the selected timer are owned by the ADC while sampling is running,
+ *       and the timer selection for CCP1 is changed to Timer1.
+ * @param adc A pointer to the ADC configuration structure.
+ * @param trigger A pointer to the sampling configuration structure.
+ * @param achieved_rate A pointer to store the achieved sampling rate in Hz (can be NULL).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred or the rate can't be generated from _XTAL_FREQ.
+ */
+Std_ReturnType ADC_Triggered_Sampling_Start(const adc_config_t *adc, const adc_trigger_cfg_t *trigger,
+                                            uint32 *achieved_rate);
+
+/**
+ * @brief Stops hardware-paced sampling and releases CCP2 and the timer.
+ * 
+ * @param adc A pointer to the ADC configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Triggered_Sampling_Stop(const adc_config_t *adc);
+
+/**
+ * @brief Reads the oldest sample from the sampling ring buffer.
+ * 
+ * @param sample A pointer to store the sample.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: A sample was read.
+ *         - E_NOT_OK: The buffer is empty or the pointer is NULL.
+ */
+Std_ReturnType ADC_Triggered_Sampling_Read(uint16 *sample);
+
+/**
+ * @brief Reports how many samples are waiting and how many were dropped.
+ * 
+ * @param available A pointer to store the number of unread samples (can be NULL).
+ * @param dropped A pointer to store the number of dropped samples since start (can be NULL).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Triggered_Sampling_Status(uint8 *available, uint32 *dropped);
+#endif
+
+#if ADC_CFG_OVERSAMPLING==ADC_CFG_FEATURE_ENABLE
+/**
+ * @brief Sets the oversampling ratio of a channel.
+ * 
+ * Every output of a channel with n extra bits is the sum of 4^n conversions shifted right
+ * by n. The sum is kept as a running total in ADC_ISR(), so no division is done per sample.
+ * When the conversions are started by software (ADC_Start_Conversion_Interrupt()),
+ * ADC_ISR() restarts the converter itself until the 4^n block is complete; in triggered
+ * sampling mode every special event adds one conversion and only decimated results are
+ * pushed into the sampling ring buffer.
+ * 
+ *   n | result | conversions per output | output rate
+ *   0 | 10-bit |   1                    | Fs
+ *   1 | 11-bit |   4                    | Fs / 4
+ *   2 | 12-bit |  16                    | Fs / 16
+ *   3 | 13-bit |  64                    | Fs / 64
+ *   4 | 14-bit | 256                    | Fs / 256
+ * 
+ * Fs is the conversion rate: 1 / ((ACQT + 11) * TAD + 2 * TAD) when conversions run back
+ * to back, or the triggered sampling rate.
+ * 
+ * @note Oversampling only adds resolution when the input carries at least 1 LSB of random
+ *       noise. On a quiet input, add dither of 1 to 2 LSB peak-to-peak (e.g. a triangle wave
+ *       or a resistor from a PWM pin into the source) that averages to zero over 4^n samples.
+ * @param channel The channel to configure.
+ * @param extra_bits @ref ADC_OVERSAMPLING_OFF to @ref ADC_OVERSAMPLING_14_BITS.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid channel or extra bits.
+ */
+Std_ReturnType ADC_Oversampling_Set(adc_channel_t channel, uint8 extra_bits);
+#endif
+
+#if ADC_CFG_FILTERS==ADC_CFG_FEATURE_ENABLE
+/**
+ * @brief Attaches a filter to a channel, ADC_ISR() runs it on every result of the channel.
+ * 
+ * The filter runs after oversampling, so it sees the decimated (10 + n)-bit results.
+ * The filtered value is what ADC_Get_Channel_Result() returns, what the triggered sampling
+ * ring buffer receives and what the channel callback reports. Its cost per sample (see
+ * adc_filter.h) is added to ADC_ISR(), keep it below the conversion period.
+ * 
+ * @param channel The channel to filter.
+ * @param filter A pointer to an initialized filter instance, or NULL to detach.
+ *               The instance must stay valid while attached.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid channel.
+ */
+Std_ReturnType ADC_Filter_Attach(adc_channel_t channel, adc_filter_t *filter);
+#endif
+
+#if ADC_CHANNEL_RESULTS==ADC_CFG_FEATURE_ENABLE
+/**
+ * @brief Retrieves the latest processed result of a channel.
+ * 
+ * The result went through oversampling and the attached filter, if any.
+ * 
+ * @param channel The channel to read.
+ * @param adc_res A pointer to store the right justified result.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: A new result was read.
+ *         - E_NOT_OK: No new result since the last read, or invalid parameters.
+ */
+Std_ReturnType ADC_Get_Channel_Result(adc_channel_t channel, uint16 *adc_res);
+#endif
+
+#if ADC_CFG_WINDOW_COMPARATOR==ADC_CFG_FEATURE_ENABLE
+/**
+ * @brief Arms the window comparator of a channel.
+ * 
+ * ADC_ISR() compares every processed result of the channel (after oversampling and
+ * filtering) against the window. Only crossings are reported: the callback is invoked and
+ * the channel bit is set in the pending event mask read by ADC_Window_Get_Events().
+ * The channel starts inside the window, so a first result already outside is a crossing.
+ * 
+ * @param channel The channel to watch.
+ * @param window A pointer to the window configuration, copied by the driver.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid channel, or low_threshold above high_threshold.
+ */
+Std_ReturnType ADC_Window_Set(adc_channel_t channel, const adc_window_cfg_t *window);
+
+/**
+ * @brief Disarms the window comparator of a channel and clears its pending event.
+ * 
+ * @param channel The channel.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid channel.
+ */
+Std_ReturnType ADC_Window_Disable(adc_channel_t channel);
+
+/**
+ * @brief Reads the current window state of a channel.
+ * 
+ * @param channel The channel.
+ * @param state A pointer to store the state.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid parameters.
+ */
+Std_ReturnType ADC_Window_Get_State(adc_channel_t channel, adc_window_state_t *state);
+
+/**
+ * @brief Reads and clears the pending crossing events.
+ * 
+ * @param events A pointer to store the event mask, bit n set means channel n crossed
+ *               its window since the last call.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Window_Get_Events(uint16 *events);
+#endif
+
 #endif	/* ADC_H */
 
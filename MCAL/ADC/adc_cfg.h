@@ -11,6 +11,30 @@
 /* -------------- Includes -------------- */
 
 /* -------------- Macro Declarations ------------- */
+#define ADC_CFG_FEATURE_ENABLE          1U
+#define ADC_CFG_FEATURE_DISABLE         0U
+
+//Hardware-paced sampling: CCP2 special event trigger starts every conversion.
+#define ADC_CFG_TRIGGERED_SAMPLING      ADC_CFG_FEATURE_ENABLE
+//Number of samples held by the sampling ring buffer (power of two, 2 to 128).
+#define ADC_CFG_SAMPLE_BUFFER_SIZE      16U
+
+//Oversampling and decimation for 11 to 14-bit results.
+#define ADC_CFG_OVERSAMPLING            ADC_CFG_FEATURE_ENABLE
+
+//Per-channel filters run by ADC_ISR() (see adc_filter.h).
+#define ADC_CFG_FILTERS                 ADC_CFG_FEATURE_ENABLE
+//Longest moving average window (power of two, 2 to 64), sizes every filter instance.
+#define ADC_CFG_FILTER_MA_MAX_WINDOW    16U
+
+//Per-channel window comparator with hysteresis evaluated by ADC_ISR().
+#define ADC_CFG_WINDOW_COMPARATOR       ADC_CFG_FEATURE_ENABLE
+
+//Analog source seen by the ADC inputs, used to size the acquisition time.
+#define ADC_CFG_SOURCE_IMPEDANCE_OHMS   2500UL
+#define ADC_CFG_MAX_TEMPERATURE_C       85UL
+//Per-channel fast/accurate timing profiles applied on channel selection.
+#define ADC_CFG_CONVERSION_PROFILES     ADC_CFG_FEATURE_ENABLE
 
 /* -------------- Macro Functions Declarations --------------*/
 
@@ -0,0 +1,371 @@
+/*
+ * File:   adc_filter.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+#include "adc_filter.h"
+
+static inline void ADC_Filter_Moving_Average(adc_filter_ma_t *ma, uint8 primed, uint16 sample, uint16 *output);
+static inline void ADC_Filter_IIR(adc_filter_iir_t *iir, uint8 primed, uint16 sample, uint16 *output);
+static inline void ADC_Filter_Median(adc_filter_median_t *median, uint8 primed, uint16 sample, uint16 *output);
+static inline void ADC_Filter_Biquad(adc_filter_biquad_t *biquad, uint8 primed, uint16 sample, uint16 *output);
+static inline sint16 ADC_Filter_Biquad_Saturate(sint32 value);
+
+/**
+ * @brief Initializes a moving average filter.
+ *
+ * @param filter A pointer to the filter instance.
+ * @param window_log2 The window is 2^window_log2 samples (up to ADC_CFG_FILTER_MA_MAX_WINDOW).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Filter_Init_Moving_Average(adc_filter_t *filter, uint8 window_log2)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == filter || ZERO_INIT == window_log2 || window_log2 > 7 ||
+       (1U << window_log2) > ADC_CFG_FILTER_MA_MAX_WINDOW)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        filter->type = ADC_FILTER_MOVING_AVERAGE;
+        filter->state.ma.window_log2 = window_log2;
+        filter->primed = 0;
+    }
+    return ret;
+}
+
+/**
+ * @brief Initializes a single-pole IIR filter with a shift-based coefficient.
+ *
+ * @param filter A pointer to the filter instance.
+ * @param shift The smoothing factor is 1/2^shift (1 to ADC_FILTER_IIR_MAX_SHIFT).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Filter_Init_IIR(adc_filter_t *filter, uint8 shift)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == filter || ZERO_INIT == shift || shift > ADC_FILTER_IIR_MAX_SHIFT)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        filter->type = ADC_FILTER_IIR;
+        filter->state.iir.shift = shift;
+        filter->primed = 0;
+    }
+    return ret;
+}
+
+/**
+ * @brief Initializes a median filter.
+ *
+ * @param filter A pointer to the filter instance.
+ * @param length ADC_FILTER_MEDIAN_3 or ADC_FILTER_MEDIAN_5.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Filter_Init_Median(adc_filter_t *filter, uint8 length)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == filter || (ADC_FILTER_MEDIAN_3 != length && ADC_FILTER_MEDIAN_5 != length))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        filter->type = ADC_FILTER_MEDIAN;
+        filter->state.median.length = length;
+        filter->primed = 0;
+    }
+    return ret;
+}
+
+/**
+ * @brief Initializes a biquad filter.
+ *
+ * @param filter A pointer to the filter instance.
+ * @param coefficients Q2.14 coefficients in the order b0, b1, b2, a1, a2.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Filter_Init_Biquad(adc_filter_t *filter, const sint16 coefficients[5])
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == filter || NULL == coefficients)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        filter->type = ADC_FILTER_BIQUAD;
+        filter->state.biquad.b0 = coefficients[0];
+        filter->state.biquad.b1 = coefficients[1];
+        filter->state.biquad.b2 = coefficients[2];
+        filter->state.biquad.a1 = coefficients[3];
+        filter->state.biquad.a2 = coefficients[4];
+        filter->primed = 0;
+    }
+    return ret;
+}
+
+/**
+ * @brief Clears the filter history, the next sample primes the filter again.
+ *
+ * @param filter A pointer to the filter instance.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Filter_Reset(adc_filter_t *filter)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == filter)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        filter->primed = 0;
+    }
+    return ret;
+}
+
+/**
+ * @brief Runs one sample through the filter.
+ *
+ * The first sample after init or reset fills the history, so there is no start-up ramp.
+ * Safe to call from ADC_ISR() or from the main loop, but not both on the same instance.
+ *
+ * @param filter A pointer to the filter instance.
+ * @param sample The input sample.
+ * @param output A pointer to store the filtered sample.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Filter_Process(adc_filter_t *filter, uint16 sample, uint16 *output)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == filter || NULL == output)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        switch(filter->type)
+        {
+            case ADC_FILTER_MOVING_AVERAGE:
+                ADC_Filter_Moving_Average(&(filter->state.ma), filter->primed, sample, output);
+                break;
+            case ADC_FILTER_IIR:
+                ADC_Filter_IIR(&(filter->state.iir), filter->primed, sample, output);
+                break;
+            case ADC_FILTER_MEDIAN:
+                ADC_Filter_Median(&(filter->state.median), filter->primed, sample, output);
+                break;
+            case ADC_FILTER_BIQUAD:
+                ADC_Filter_Biquad(&(filter->state.biquad), filter->primed, sample, output);
+                break;
+            default:
+                ret = E_NOT_OK;
+                break;
+        }
+        if(E_OK == ret)
+        {
+            filter->primed = 1;
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief Moving average, the oldest sample leaves the running sum as the new one enters.
+ *
+ */
+static inline void ADC_Filter_Moving_Average(adc_filter_ma_t *ma, uint8 primed, uint16 sample, uint16 *output)
+{
+    uint8 l_window = (uint8)(1U << ma->window_log2);
+    uint8 l_index = ZERO_INIT;
+
+    if(0 == primed)
+    {
+        for(l_index = 0; l_index < l_window; l_index++)
+        {
+            ma->history[l_index] = sample;
+        }
+        ma->sum = (uint32)sample << ma->window_log2;
+        ma->index = 0;
+    }
+    else
+    {
+        ma->sum -= ma->history[ma->index];
+        ma->sum += sample;
+        ma->history[ma->index] = sample;
+        ma->index = (uint8)((ma->index + 1) & (l_window - 1));
+    }
+    //Rounded division by the window length
+    *output = (uint16)((ma->sum + (l_window >> 1)) >> ma->window_log2);
+}
+
+/**
+ * @brief Single-pole IIR, state holds y * 2^shift so no fraction bits are lost.
+ *
+ */
+static inline void ADC_Filter_IIR(adc_filter_iir_t *iir, uint8 primed, uint16 sample, uint16 *output)
+{
+    if(0 == primed)
+    {
+        iir->state = (uint32)sample << iir->shift;
+    }
+    else
+    {
+        //y += (x - y) / 2^shift, scaled by 2^shift
+        iir->state = iir->state - (iir->state >> iir->shift) + sample;
+    }
+    *output = (uint16)((iir->state + (1UL << (iir->shift - 1))) >> iir->shift);
+}
+
+/**
+ * @brief Median of the last 3 or 5 samples.
+ *
+ */
+static inline void ADC_Filter_Median(adc_filter_median_t *median, uint8 primed, uint16 sample, uint16 *output)
+{
+    uint16 l_sorted[ADC_FILTER_MEDIAN_5];
+    uint16 l_value = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_pos = ZERO_INIT;
+
+    if(0 == primed)
+    {
+        for(l_index = 0; l_index < median->length; l_index++)
+        {
+            median->history[l_index] = sample;
+        }
+        median->index = 0;
+    }
+    else
+    {
+        median->history[median->index] = sample;
+    }
+    median->index++;
+    if(median->index >= median->length)
+    {
+        median->index = 0;
+    }else{/* Nothing */}
+
+    if(ADC_FILTER_MEDIAN_3 == median->length)
+    {
+        uint16 a = median->history[0];
+        uint16 b = median->history[1];
+        uint16 c = median->history[2];
+        //Three compares, no copy
+        if(a > b)
+        {
+            l_value = a;
+            a = b;
+            b = l_value;
+        }else{/* Nothing */}
+        *output = (c <= a) ? a : ((c >= b) ? b : c);
+    }
+    else
+    {
+        //Insertion sort of five samples
+        for(l_index = 0; l_index < ADC_FILTER_MEDIAN_5; l_index++)
+        {
+            l_value = median->history[l_index];
+            l_pos = l_index;
+            while(l_pos > 0 && l_sorted[l_pos - 1] > l_value)
+            {
+                l_sorted[l_pos] = l_sorted[l_pos - 1];
+                l_pos--;
+            }
+            l_sorted[l_pos] = l_value;
+        }
+        *output = l_sorted[2];
+    }
+}
+
+/**
+ * @brief Direct form I biquad with a 32-bit accumulator and Q2.14 coefficients.
+ *
+ */
+static inline void ADC_Filter_Biquad(adc_filter_biquad_t *biquad, uint8 primed, uint16 sample, uint16 *output)
+{
+    sint16 l_x = (sample > ADC_FILTER_BIQUAD_MAX_SAMPLE) ? ADC_FILTER_BIQUAD_MAX_SAMPLE : (sint16)sample;
+    sint32 l_acc = ZERO_INIT;
+    sint32 l_den = ZERO_INIT;
+    sint16 l_y = ZERO_INIT;
+
+    if(0 == primed)
+    {
+        //Start from the steady state for a constant input: y = x * sum(b) / (1 + a1 + a2)
+        l_den = (sint32)ADC_FILTER_BIQUAD_ONE + biquad->a1 + biquad->a2;
+        if(l_den > 0)
+        {
+            l_acc = (sint32)l_x * ((sint32)biquad->b0 + biquad->b1 + biquad->b2);
+            l_y = ADC_Filter_Biquad_Saturate(l_acc / l_den);
+        }
+        else
+        {
+            l_y = l_x;
+        }
+        biquad->x1 = l_x;
+        biquad->x2 = l_x;
+        biquad->y1 = l_y;
+        biquad->y2 = l_y;
+    }
+    else
+    {
+        l_acc = (sint32)biquad->b0 * l_x;
+        l_acc += (sint32)biquad->b1 * biquad->x1;
+        l_acc += (sint32)biquad->b2 * biquad->x2;
+        l_acc -= (sint32)biquad->a1 * biquad->y1;
+        l_acc -= (sint32)biquad->a2 * biquad->y2;
+        //Back to the sample scale with rounding
+        l_y = ADC_Filter_Biquad_Saturate((l_acc + (1L << (ADC_FILTER_BIQUAD_Q - 1))) >> ADC_FILTER_BIQUAD_Q);
+        biquad->x2 = biquad->x1;
+        biquad->x1 = l_x;
+        biquad->y2 = biquad->y1;
+        biquad->y1 = l_y;
+    }
+    *output = (uint16)l_y;
+}
+
+/**
+ * @brief Clamps a biquad output to the 14-bit sample range.
+ *
+ */
+static inline sint16 ADC_Filter_Biquad_Saturate(sint32 value)
+{
+    sint16 l_res = ZERO_INIT;
+
+    if(value < 0)
+    {
+        l_res = 0;
+    }
+    else if(value > ADC_FILTER_BIQUAD_MAX_SAMPLE)
+    {
+        l_res = ADC_FILTER_BIQUAD_MAX_SAMPLE;
+    }
+    else
+    {
+        l_res = (sint16)value;
+    }
+    return l_res;
+}
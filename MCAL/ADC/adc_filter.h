@@ -0,0 +1,204 @@
+/*
+ * File:   adc_filter.h
+ * Author: Mohamed Sameh
+ *
+ * Integer filters for uint16 ADC samples. A filter instance can be attached to an ADC
+ * channel with ADC_Filter_Attach() and run inside ADC_ISR(), or be fed from the main loop
+ * with ADC_Filter_Process().
+ *
+ * Rough cost per sample on PIC18, hand estimates from the C code (not measured on XC8
+ * output, check the listing or the simulator stopwatch before relying on them):
+ *   - Moving average : ~70 instruction cycles, independent of the window length.
+ *   - IIR            : ~50 + 12 * shift instruction cycles.
+ *   - Median of 3    : ~60 instruction cycles.
+ *   - Median of 5    : ~180 instruction cycles.
+ *   - Biquad         : ~350 instruction cycles (five 16x16 signed multiplies).
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef ADC_FILTER_H
+#define	ADC_FILTER_H
+
+/* -------------- Includes -------------- */
+#include "../std_types.h"
+#include "adc_cfg.h"
+
+/* -------------- Macro Declarations ------------- */
+#if (ADC_CFG_FILTER_MA_MAX_WINDOW < 2) || (ADC_CFG_FILTER_MA_MAX_WINDOW > 64) || \
+    (ADC_CFG_FILTER_MA_MAX_WINDOW & (ADC_CFG_FILTER_MA_MAX_WINDOW - 1))
+#error "ADC_CFG_FILTER_MA_MAX_WINDOW must be a power of two between 2 and 64"
+#endif
+
+//Largest IIR shift, the smoothing factor is 1/2^shift.
+#define ADC_FILTER_IIR_MAX_SHIFT     8U
+//Median lengths.
+#define ADC_FILTER_MEDIAN_3          3U
+#define ADC_FILTER_MEDIAN_5          5U
+//Biquad coefficients are signed Q2.14 (16384 = 1.0), samples are saturated to 14 bits.
+#define ADC_FILTER_BIQUAD_Q          14U
+#define ADC_FILTER_BIQUAD_ONE        16384
+#define ADC_FILTER_BIQUAD_MAX_SAMPLE 16383
+
+/* -------------- Macro Functions Declarations --------------*/
+//Converts a real coefficient to Q2.14 at compile time (|coefficient| < 2).
+#define ADC_FILTER_BIQUAD_COEF(_X)   ((sint16)((_X) * ADC_FILTER_BIQUAD_ONE + (((_X) < 0) ? -0.5 : 0.5)))
+
+/* -------------- Data Types Declarations --------------  */
+/**
+ * @brief Filter Type Select
+ *
+ */
+typedef enum
+{
+    ADC_FILTER_MOVING_AVERAGE = 0,
+    ADC_FILTER_IIR,
+    ADC_FILTER_MEDIAN,
+    ADC_FILTER_BIQUAD
+}adc_filter_type_t;
+
+/**
+ * @brief Moving average with an O(1) running sum over 2^window_log2 samples.
+ *
+ */
+typedef struct
+{
+    uint16 history[ADC_CFG_FILTER_MA_MAX_WINDOW];
+    uint32 sum;
+    uint8 index;
+    uint8 window_log2;
+}adc_filter_ma_t;
+
+/**
+ * @brief Single-pole IIR: y += (x - y) / 2^shift, state kept with shift fraction bits.
+ *
+ */
+typedef struct
+{
+    uint32 state;
+    uint8 shift;
+}adc_filter_iir_t;
+
+/**
+ * @brief Median of the last 3 or 5 samples, for spike rejection.
+ *
+ */
+typedef struct
+{
+    uint16 history[ADC_FILTER_MEDIAN_5];
+    uint8 index;
+    uint8 length;
+}adc_filter_median_t;
+
+/**
+ * @brief Fixed-point biquad (direct form I), Q2.14 coefficients.
+ *
+ * y = b0*x + b1*x1 + b2*x2 - a1*y1 - a2*y2 (a0 normalized to 1).
+ * Inputs and outputs are limited to 14 bits (0..16383, oversampled results included).
+ * The 32-bit accumulator can't overflow as long as the sum of the coefficient
+ * magnitudes stays below 4.0, which holds for practical low-pass, band-pass and notch designs.
+ * The first sample primes the history with the DC steady state of the filter.
+ */
+typedef struct
+{
+    sint16 b0;
+    sint16 b1;
+    sint16 b2;
+    sint16 a1;
+    sint16 a2;
+    sint16 x1;
+    sint16 x2;
+    sint16 y1;
+    sint16 y2;
+}adc_filter_biquad_t;
+
+/**
+ * @brief ADC Filter Instance
+ *
+ */
+typedef struct
+{
+    adc_filter_type_t type;         /* @ref adc_filter_type_t */
+    uint8 primed : 1;               /* Set once the first sample initialized the state */
+    uint8 filter_reserved : 7;
+    union
+    {
+        adc_filter_ma_t ma;
+        adc_filter_iir_t iir;
+        adc_filter_median_t median;
+        adc_filter_biquad_t biquad;
+    }state;
+}adc_filter_t;
+
+/* -------------- Functions Declarations --------------*/
+/**
+ * @brief Initializes a moving average filter.
+ *
+ * @param filter A pointer to the filter instance.
+ * @param window_log2 The window is 2^window_log2 samples (up to ADC_CFG_FILTER_MA_MAX_WINDOW).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Filter_Init_Moving_Average(adc_filter_t *filter, uint8 window_log2);
+
+/**
+ * @brief Initializes a single-pole IIR filter with a shift-based coefficient.
+ *
+ * @param filter A pointer to the filter instance.
+ * @param shift The smoothing factor is 1/2^shift (1 to ADC_FILTER_IIR_MAX_SHIFT).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Filter_Init_IIR(adc_filter_t *filter, uint8 shift);
+
+/**
+ * @brief Initializes a median filter.
+ *
+ * @param filter A pointer to the filter instance.
+ * @param length ADC_FILTER_MEDIAN_3 or ADC_FILTER_MEDIAN_5.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Filter_Init_Median(adc_filter_t *filter, uint8 length);
+
+/**
+ * @brief Initializes a biquad filter.
+ *
+ * @param filter A pointer to the filter instance.
+ * @param coefficients Q2.14 coefficients in the order b0, b1, b2, a1, a2.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Filter_Init_Biquad(adc_filter_t *filter, const sint16 coefficients[5]);
+
+/**
+ * @brief Clears the filter history, the next sample primes the filter again.
+ *
+ * @param filter A pointer to the filter instance.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Filter_Reset(adc_filter_t *filter);
+
+/**
+ * @brief Runs one sample through the filter.
+ *
+ * The first sample after init or reset fills the history, so there is no start-up ramp.
+ * Safe to call from ADC_ISR() or from the main loop, but not both on the same instance.
+ *
+ * @param filter A pointer to the filter instance.
+ * @param sample The input sample.
+ * @param output A pointer to store the filtered sample.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Filter_Process(adc_filter_t *filter, uint16 sample, uint16 *output);
+
+#endif	/* ADC_FILTER_H */
+
@@ -80,4 +80,73 @@ Std_ReturnType EEPROM_ReadByte(uint16 bAdd, uint8 *bData)
         *bData = EEDATA;
     }
     return ret;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Starts writing one byte to a specific EEPROM Address and returns immediately.
+ * 
+ * @param bAdd The EEPROM address to write at.
+ * @param bData Data to be written.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The write cycle was started.
+ *         - E_NOT_OK: A write cycle is still in progress.
+ */
+Std_ReturnType EEPROM_WriteByte_Start(uint16 bAdd, uint8 bData)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 Global_Interrupt_Status = INTCONbits.GIE;
+
+    if(EECON1bits.WR)
+    {
+        //EEADR and EEDATA can't change during a write cycle
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //Updates the Data Memory Address to write at
+        EEADRH = (uint8)((bAdd >> 8) & 0x03);
+        EEADR = (uint8)(bAdd & 0xFF);
+        //Data Memory Value to write
+        EEDATA = bData;
+        //Access EEPROM
+        EECON1bits.EEPGD = ACCESS_EEPROM_MEMORY;
+        EECON1bits.CFGS = ACCESS_FLASH_EEPROM_MEMORY;
+        //Allows write cycles to Flash program/data EEPROM
+        EECON1bits.WREN = ALLOW_WRITE_CYCLES;
+        //Disable all interrupts for the required seq only
+        INTCONbits.GIE = 0;
+        EECON2 = 0x55;
+        EECON2 = 0xAA;
+        //Initiates a data EEPROM erase/write cycle
+        EECON1bits.WR = INITIATE_EEPROM_DATA_WRITE_ERASE;
+        //Restores the Interrupt Status "enabled or disabled"
+        INTCONbits.GIE = Global_Interrupt_Status;
+        //Clearing WREN doesn't affect the cycle in progress
+        EECON1bits.WREN = INHIBITS_WRITE_CYCLES;
+    }
+    return ret;
+}
+
+/**
+ * @brief Reports whether a write cycle is in progress.
+ * 
+ * @param busy A pointer to store 1 while writing, 0 when the EEPROM can be accessed.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EEPROM_Write_Busy(uint8 *busy)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == busy)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //WR is cleared by hardware when the write cycle completes
+        *busy = (uint8)(EECON1bits.WR != EEPROM_DATA_WRITE_ERASE_COMPLETED);
+    }
+    return ret;
+}
@@ -54,5 +54,29 @@ Std_ReturnType EEPROM_WriteByte(uint16 bAdd, uint8 bData);
  */
 Std_ReturnType EEPROM_ReadByte(uint16 bAdd, uint8 *bData);
 
+/**
+ * @brief Starts writing one byte to a specific EEPROM Address and returns immediately.
+ * 
+ * The write cycle takes about 4 ms, poll EEPROM_Write_Busy() before the next access.
+ * Interrupts are only held off for the unlock sequence.
+ * 
+ * @param bAdd The EEPROM address to write at.
+ * @param bData Data to be written.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The write cycle was started.
+ *         - E_NOT_OK: A write cycle is still in progress.
+ */
+Std_ReturnType EEPROM_WriteByte_Start(uint16 bAdd, uint8 bData);
+
+/**
+ * @brief Reports whether a write cycle is in progress.
+ * 
+ * @param busy A pointer to store 1 while writing, 0 when the EEPROM can be accessed.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EEPROM_Write_Busy(uint8 *busy);
+
 #endif	/* EEPROM_H */
 
@@ -11,9 +11,45 @@ static void (*I2C_InterruptHandler)(void) = NULL;
 static void (*I2C_Interrupt_Write_Col)(void) = NULL;
 #endif
 
+#if I2C_CFG_ASYNC==I2C_CFG_FEATURE_ENABLE
+/**
+ * @brief Transaction State, the MSSP event I2C_ISR() is waiting for
+ */
+typedef enum
+{
+    I2C_ASYNC_START = 0,            /* START or repeated START */
+    I2C_ASYNC_ADDRESS,              /* Address byte sent */
+    I2C_ASYNC_WRITE,                /* Data byte sent */
+    I2C_ASYNC_READ,                 /* Data byte received */
+    I2C_ASYNC_ACK,                  /* ACK or NACK of a received byte sent */
+    I2C_ASYNC_RESTART_STOP,         /* STOP between the phases, a START follows */
+    I2C_ASYNC_STOP                  /* Final STOP */
+}i2c_async_state_t;
+
+static i2c_transaction_t i2c_queue[I2C_CFG_QUEUE_SIZE];
+//Free running indexes, the slot at the tail is the running transaction.
+static volatile uint8 i2c_queue_head = ZERO_INIT;   /* I2C_Async_Submit() */
+static volatile uint8 i2c_queue_tail = ZERO_INIT;   /* I2C_ISR() */
+static volatile uint8 i2c_async_active = ZERO_INIT;
+static uint8 i2c_async_bus_held = ZERO_INIT;        /* The last transaction ended without STOP */
+static uint8 i2c_async_reading = ZERO_INIT;         /* Read phase */
+static uint8 i2c_async_index = ZERO_INIT;           /* Byte of the current phase */
+static i2c_async_state_t i2c_async_state = I2C_ASYNC_START;
+static i2c_transaction_status_t i2c_async_status = I2C_TRANSACTION_OK;
+
+static void I2C_Async_Start(void);
+static void I2C_Async_Event(void);
+static void I2C_Async_End_Phase(void);
+static void I2C_Async_Finish(void);
+static void I2C_Async_Complete(void);
+#endif
+
 static void inline I2C_Gpio_Configurations();
 static void inline I2C_Interrupt_Configure(const I2C_t *_i2c);
 static Std_ReturnType inline I2C_Slave_Mode_Select(const I2C_t *_i2c);
+static Std_ReturnType I2C_Master_Transmit_Acked(uint8 data);
+static void I2C_Master_Wait_Idle(void);
+static void I2C_Master_Receive_Byte(uint8 *data, uint8 _ack);
 
 /**
  * @brief Initializes the I2C module in master mode based on the provided configuration.
@@ -418,6 +454,182 @@ Std_ReturnType I2C_Master_Send_1Byte(uint8 slave_address, uint8 data, uint8 *_ac
     return ret; 
 }
 
+/**
+ * @brief Writes consecutive registers of a slave in one transfer.
+ * 
+ * @param slave_address The 7-bit address of the slave.
+ * @param reg The first register address.
+ * @param buf The bytes to write.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: A byte was not acknowledged, or asynchronous transactions are pending.
+ */
+Std_ReturnType I2C_Master_WriteRegs(uint8 slave_address, uint8 reg, const uint8 *buf, uint8 len)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+
+    if(NULL == buf || slave_address > 0x7FU)
+    {
+        ret = E_NOT_OK;
+    }
+#if I2C_CFG_ASYNC==I2C_CFG_FEATURE_ENABLE
+    else if(i2c_async_active || i2c_async_bus_held)
+    {
+        ret = E_NOT_OK;
+    }
+#endif
+    else
+    {
+        I2C_Master_Wait_Idle();
+        ret = I2C_Master_Send_Start();
+        if(E_OK == ret)
+        {
+            ret = I2C_Master_Transmit_Acked((uint8)((uint8)(slave_address << 1) | I2C_WRITE_OPPERATION));
+        }else{/* Nothing */}
+        if(E_OK == ret)
+        {
+            ret = I2C_Master_Transmit_Acked(reg);
+        }else{/* Nothing */}
+        while(E_OK == ret && l_index < len)
+        {
+            ret = I2C_Master_Transmit_Acked(buf[l_index++]);
+        }
+        //The bus is released even after a NACK
+        ret &= I2C_Master_Send_Stop();
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads consecutive registers of a slave in one transfer.
+ * 
+ * @param slave_address The 7-bit address of the slave.
+ * @param reg The first register address.
+ * @param buf A buffer to store the bytes.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: A byte was not acknowledged, or asynchronous transactions are pending.
+ */
+Std_ReturnType I2C_Master_ReadRegs(uint8 slave_address, uint8 reg, uint8 *buf, uint8 len)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+
+    if(NULL == buf || ZERO_INIT == len || slave_address > 0x7FU)
+    {
+        ret = E_NOT_OK;
+    }
+#if I2C_CFG_ASYNC==I2C_CFG_FEATURE_ENABLE
+    else if(i2c_async_active || i2c_async_bus_held)
+    {
+        ret = E_NOT_OK;
+    }
+#endif
+    else
+    {
+        //Register pointer
+        I2C_Master_Wait_Idle();
+        ret = I2C_Master_Send_Start();
+        if(E_OK == ret)
+        {
+            ret = I2C_Master_Transmit_Acked((uint8)((uint8)(slave_address << 1) | I2C_WRITE_OPPERATION));
+        }else{/* Nothing */}
+        if(E_OK == ret)
+        {
+            ret = I2C_Master_Transmit_Acked(reg);
+        }else{/* Nothing */}
+        //Turn the bus around without releasing it
+        if(E_OK == ret)
+        {
+            ret = I2C_Master_Send_Repeated_Start();
+            if(E_OK == ret)
+            {
+                ret = I2C_Master_Transmit_Acked((uint8)((uint8)(slave_address << 1) | I2C_READ_OPPERATION));
+            }else{/* Nothing */}
+        }else{/* Nothing */}
+        while(E_OK == ret && l_index < len)
+        {
+            I2C_Master_Receive_Byte(&buf[l_index], (uint8)((l_index + 1U < len) ? I2C_ACK : I2C_NOT_ACK));
+            l_index++;
+        }
+        ret &= I2C_Master_Send_Stop();
+    }
+    return ret;
+}
+
+#if I2C_CFG_ASYNC==I2C_CFG_FEATURE_ENABLE
+/**
+ * @brief Queues a master transaction and returns immediately.
+ * 
+ * @param transaction A pointer to the transaction, copied into the queue.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The transaction was queued.
+ *         - E_NOT_OK: The queue is full, the MSSP isn't an I2C master, or invalid transaction.
+ */
+Std_ReturnType I2C_Async_Submit(const i2c_transaction_t *transaction)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_global_interrupt_status = INTCONbits.GIE;
+    uint8 l_head = ZERO_INIT;
+
+    if(NULL == transaction || transaction->address > 0x7FU ||
+       (transaction->write_len && NULL == transaction->write_buf) ||
+       (transaction->read_len && NULL == transaction->read_buf) ||
+       I2C_MASTER_DEFINED_CLOCK != SSPCON1bits.SSPM)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //Submitters may run at both interrupt priorities, claim the slot with all interrupts off
+        INTCONbits.GIE = 0;
+        l_head = i2c_queue_head;
+        if((uint8)(l_head - i2c_queue_tail) >= I2C_CFG_QUEUE_SIZE)
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            i2c_queue[l_head & I2C_QUEUE_MASK] = *transaction;
+            i2c_queue_head = (uint8)(l_head + 1);
+            //Start the engine if it is idle
+            if(ZERO_INIT == i2c_async_active)
+            {
+                I2C_Async_Start();
+            }else{/* Nothing */}
+        }
+        INTCONbits.GIE = l_global_interrupt_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief Reports the number of transactions not completed yet, the running one included.
+ * 
+ * @param pending A pointer to store the number of transactions.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType I2C_Async_Pending(uint8 *pending)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == pending)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *pending = (uint8)(i2c_queue_head - i2c_queue_tail);
+    }
+    return ret;
+}
+#endif
+
 
 /**
  * @brief Helper function to Select Master Mode  
@@ -441,6 +653,68 @@ static Std_ReturnType inline I2C_Slave_Mode_Select(const I2C_t *_i2c)
     return ret;
 }
 
+/**
+ * @brief Helper function to transmit a byte, E_NOT_OK when the slave doesn't acknowledge it
+ *
+ * BF clears after the 8th bit, ACKSTAT is only valid once the 9th clock is over.
+ */
+static Std_ReturnType I2C_Master_Transmit_Acked(uint8 data)
+{
+    Std_ReturnType ret = E_OK;
+
+    I2C_Master_Wait_Idle();
+    SSPBUF = data;
+    if(I2C_TRANSMIT_COLLISION_CHECK() == I2C_WRITE_COLLISION_OCCURRED)
+    {
+        I2C_TRANSMIT_COLLISION_CLEAR();
+        SSPBUF = data;
+    }else{/* Nothing */}
+    //R_W stays set until the acknowledge is in
+    I2C_Master_Wait_Idle();
+    PIR1bits.SSPIF = 0; /* Clear The Interrupt flag */
+    if(I2C_ACK != I2C_MASTER_ACK_CHECK())
+    {
+        ret = E_NOT_OK;
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief Helper function to wait until no transmission and no condition is in progress
+ *
+ * The MSSP ignores SEN, RSEN, PEN, RCEN and ACKEN written before then. SSPIF isn't polled
+ * since I2C_ISR() may clear it first, the callers still clear it after each step like the
+ * other blocking functions.
+ */
+static void I2C_Master_Wait_Idle(void)
+{
+    while(SSPSTATbits.R_W || (SSPCON2 & I2C_SSPCON2_BUSY_MASK));
+}
+
+/**
+ * @brief Helper function to receive a byte and answer it with an ACK or a NACK
+ *
+ * Waits for the end of the acknowledge sequence, the MSSP ignores RCEN until then.
+ */
+static void I2C_Master_Receive_Byte(uint8 *data, uint8 _ack)
+{
+    I2C_MASTER_RECEIVE_MODE_ENABLE();
+    //Waits until the reception is complete
+    while(!I2C_BUFFER_STATUS());
+    *data = SSPBUF;
+    if(I2C_ACK == _ack)
+    {
+        I2C_MASTER_RECEIVE_ACK();
+    }
+    else
+    {
+        I2C_MASTER_RECEIVE_NACK();
+    }
+    I2C_MASTER_RECEIVE_INITIATE_ACK_SEQ();
+    while(SSPCON2bits.ACKEN);
+    PIR1bits.SSPIF = 0; /* Clear The Interrupt flag */
+}
+
 static void inline I2C_Interrupt_Configure(const I2C_t *_i2c)
 {
 #if I2C_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
@@ -498,6 +772,13 @@ void I2C_ISR()
 #if I2C_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
     //MSSP I2C interrupt occurred, the flag must be cleared.
     I2C_INTERRUPT_FLAG_CLEAR();
+#if I2C_CFG_ASYNC==I2C_CFG_FEATURE_ENABLE
+    if(i2c_async_active)
+    {
+        I2C_Async_Event();
+    }
+    else
+#endif
     //CallBack func gets called every time this ISR executes.
     if(I2C_InterruptHandler)
     {
@@ -515,10 +796,196 @@ void I2C_BUS_COL_ISR()
 #if I2C_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
     //MSSP I2C interrupt occurred, the flag must be cleared
     I2C_BUS_COL_INTERRUPT_FLAG_CLEAR();
+#if I2C_CFG_ASYNC==I2C_CFG_FEATURE_ENABLE
+    //The MSSP went idle, the running transaction is lost
+    i2c_async_bus_held = ZERO_INIT;
+    if(i2c_async_active)
+    {
+        i2c_async_status = I2C_TRANSACTION_BUS_COLLISION;
+        I2C_Async_Complete();
+    }else{/* Nothing */}
+#endif
     //CallBack func gets called every time this ISR executes.
     if(I2C_Interrupt_Write_Col)
     {
         I2C_Interrupt_Write_Col();
     }else{/* Nothing */}
 #endif
-}
\ No newline at end of file
+}
+#if I2C_CFG_ASYNC==I2C_CFG_FEATURE_ENABLE
+/**
+ * @brief Starts the transaction at the queue tail with a START, or a repeated START when
+ *  the previous one kept the bus.
+ * 
+ */
+static void I2C_Async_Start(void)
+{
+    const i2c_transaction_t *l_transaction = &i2c_queue[i2c_queue_tail & I2C_QUEUE_MASK];
+
+    i2c_async_active = 1;
+    i2c_async_index = ZERO_INIT;
+    i2c_async_status = I2C_TRANSACTION_OK;
+    i2c_async_reading = (uint8)(ZERO_INIT == l_transaction->write_len && l_transaction->read_len);
+    i2c_async_state = I2C_ASYNC_START;
+    I2C_TRANSMIT_COLLISION_CLEAR();
+    if(i2c_async_bus_held)
+    {
+        i2c_async_bus_held = ZERO_INIT;
+        I2C_INITIATE_REPEATED_START_CONDITION();
+    }
+    else
+    {
+        I2C_INITIATE_START_CONDITION();
+    }
+}
+
+/**
+ * @brief An MSSP event ended the current step, I2C_ISR() context.
+ * 
+ */
+static void I2C_Async_Event(void)
+{
+    const i2c_transaction_t *l_transaction = &i2c_queue[i2c_queue_tail & I2C_QUEUE_MASK];
+
+    switch (i2c_async_state)
+    {
+        case I2C_ASYNC_START:
+            //Address and direction
+            i2c_async_state = I2C_ASYNC_ADDRESS;
+            SSPBUF = (uint8)((uint8)(l_transaction->address << 1) |
+                             (i2c_async_reading ? I2C_READ_OPPERATION : I2C_WRITE_OPPERATION));
+            break;
+        case I2C_ASYNC_ADDRESS:
+        case I2C_ASYNC_WRITE:
+            if(I2C_NOT_ACK == I2C_MASTER_ACK_CHECK())
+            {
+                i2c_async_status = (I2C_ASYNC_ADDRESS == i2c_async_state) ?
+                                   I2C_TRANSACTION_ADDRESS_NACK : I2C_TRANSACTION_DATA_NACK;
+                i2c_async_state = I2C_ASYNC_STOP;
+                I2C_INITIATE_STOP_CONDITION();
+            }
+            else if(i2c_async_reading)
+            {
+                //Address acknowledged, clock in the first byte
+                i2c_async_state = I2C_ASYNC_READ;
+                I2C_MASTER_RECEIVE_MODE_ENABLE();
+            }
+            else if(i2c_async_index < l_transaction->write_len)
+            {
+                i2c_async_state = I2C_ASYNC_WRITE;
+                SSPBUF = l_transaction->write_buf[i2c_async_index++];
+            }
+            else
+            {
+                I2C_Async_End_Phase();
+            }
+            break;
+        case I2C_ASYNC_READ:
+            l_transaction->read_buf[i2c_async_index++] = SSPBUF;
+            //ACK asks for more, NACK ends the read
+            if(i2c_async_index < l_transaction->read_len)
+            {
+                I2C_MASTER_RECEIVE_ACK();
+            }
+            else
+            {
+                I2C_MASTER_RECEIVE_NACK();
+            }
+            i2c_async_state = I2C_ASYNC_ACK;
+            I2C_MASTER_RECEIVE_INITIATE_ACK_SEQ();
+            break;
+        case I2C_ASYNC_ACK:
+            if(i2c_async_index < l_transaction->read_len)
+            {
+                i2c_async_state = I2C_ASYNC_READ;
+                I2C_MASTER_RECEIVE_MODE_ENABLE();
+            }
+            else
+            {
+                I2C_Async_Finish();
+            }
+            break;
+        case I2C_ASYNC_RESTART_STOP:
+            i2c_async_state = I2C_ASYNC_START;
+            I2C_INITIATE_START_CONDITION();
+            break;
+        case I2C_ASYNC_STOP:
+            I2C_Async_Complete();
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief The write phase is done: turn the bus around for the read phase, or finish.
+ * 
+ */
+static void I2C_Async_End_Phase(void)
+{
+    const i2c_transaction_t *l_transaction = &i2c_queue[i2c_queue_tail & I2C_QUEUE_MASK];
+
+    if(l_transaction->read_len)
+    {
+        i2c_async_reading = 1;
+        i2c_async_index = ZERO_INIT;
+        if(l_transaction->repeated_start)
+        {
+            i2c_async_state = I2C_ASYNC_START;
+            I2C_INITIATE_REPEATED_START_CONDITION();
+        }
+        else
+        {
+            i2c_async_state = I2C_ASYNC_RESTART_STOP;
+            I2C_INITIATE_STOP_CONDITION();
+        }
+    }
+    else
+    {
+        I2C_Async_Finish();
+    }
+}
+
+/**
+ * @brief All the bytes are through: send the STOP, or keep the bus for the next transaction.
+ * 
+ */
+static void I2C_Async_Finish(void)
+{
+    const i2c_transaction_t *l_transaction = &i2c_queue[i2c_queue_tail & I2C_QUEUE_MASK];
+
+    if(l_transaction->stop)
+    {
+        i2c_async_state = I2C_ASYNC_STOP;
+        I2C_INITIATE_STOP_CONDITION();
+    }
+    else
+    {
+        i2c_async_bus_held = 1;
+        I2C_Async_Complete();
+    }
+}
+
+/**
+ * @brief Frees the slot, calls the completion handler and starts the next transaction.
+ * 
+ */
+static void I2C_Async_Complete(void)
+{
+    const i2c_transaction_t *l_transaction = &i2c_queue[i2c_queue_tail & I2C_QUEUE_MASK];
+    void (*l_handler)(void *context, i2c_transaction_status_t status) = l_transaction->I2C_CompleteHandler;
+    void *l_context = l_transaction->context;
+
+    //Free the slot before the handler, it may submit the next transaction
+    i2c_queue_tail = (uint8)(i2c_queue_tail + 1);
+    i2c_async_active = ZERO_INIT;
+    if(l_handler)
+    {
+        l_handler(l_context, i2c_async_status);
+    }else{/* Nothing */}
+    if(ZERO_INIT == i2c_async_active && i2c_queue_tail != i2c_queue_head)
+    {
+        I2C_Async_Start();
+    }else{/* Nothing */}
+}
+#endif
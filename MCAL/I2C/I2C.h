@@ -49,6 +49,19 @@
 
 #define I2C_ACK         0  
 #define I2C_NOT_ACK     1
+
+/* SEN, RSEN, PEN, RCEN and ACKEN, set while a condition or a reception is in progress */
+#define I2C_SSPCON2_BUSY_MASK   0x1FU
+
+#if I2C_CFG_ASYNC==I2C_CFG_FEATURE_ENABLE
+#if I2C_INTERRUPT_ENABLE_FEATURE!=INTERRUPT_FEATURE_ENABLE
+#error "I2C_CFG_ASYNC needs I2C_INTERRUPT_ENABLE_FEATURE"
+#endif
+#if (I2C_CFG_QUEUE_SIZE < 2) || (I2C_CFG_QUEUE_SIZE > 16) || (I2C_CFG_QUEUE_SIZE & (I2C_CFG_QUEUE_SIZE - 1))
+#error "I2C_CFG_QUEUE_SIZE must be a power of two between 2 and 16"
+#endif
+#define I2C_QUEUE_MASK      (I2C_CFG_QUEUE_SIZE - 1U)
+#endif
 /* -------------- Macro Functions Declarations -------------- */
 //MSSP I2C Enable or Disable.
 #define I2C_ENABLE()     (SSPCON1bits.SSPEN = 1)
@@ -145,6 +158,41 @@ typedef struct
 #endif 
 }I2C_t;
 
+#if I2C_CFG_ASYNC==I2C_CFG_FEATURE_ENABLE
+/**
+ * @brief I2C Transaction Results
+ */
+typedef enum
+{
+    I2C_TRANSACTION_OK = 0,
+    I2C_TRANSACTION_ADDRESS_NACK,       /* No slave answered */
+    I2C_TRANSACTION_DATA_NACK,          /* The slave refused a written byte */
+    I2C_TRANSACTION_BUS_COLLISION       /* Another master or a stuck line, the bus was lost */
+}i2c_transaction_status_t;
+
+/**
+ * @brief I2C Transaction, copied into the queue by I2C_Async_Submit()
+ * 
+ * START, address + W, write_len bytes, then a repeated START (or STOP + START), address + R
+ * and read_len bytes, the last one NACKed, then STOP. Either phase can be empty, with
+ * both empty the transaction only checks that the address is acknowledged.
+ * The buffers are used by I2C_ISR() until the completion handler runs, they must stay valid.
+ */
+typedef struct
+{
+    uint8 address;                      /* 7-bit slave address */
+    const uint8 *write_buf;
+    uint8 write_len;
+    uint8 *read_buf;
+    uint8 read_len;
+    uint8 repeated_start : 1;           /* Repeated START between the phases, STOP + START otherwise */
+    uint8 stop : 1;                     /* STOP at the end, 0 holds the bus for the next transaction */
+    uint8 transaction_reserved : 6;
+    void (* I2C_CompleteHandler)(void *context, i2c_transaction_status_t status);  /* Called in I2C_ISR() (can be NULL) */
+    void *context;
+}i2c_transaction_t;
+#endif
+
 /* -------------- Software Interfaces Declarations -------------- */
 /**
  * @brief Initializes the I2C module in master mode based on the provided configuration.
@@ -289,5 +337,71 @@ Std_ReturnType I2C_Slave_Recieve(uint8 *rec_data);
  */
 Std_ReturnType I2C_Master_Send_1Byte(uint8 slave_address, uint8 data, uint8 *_ack);
 
+/**
+ * @brief Writes consecutive registers of a slave in one transfer.
+ * 
+ * START, address + W, register address, the bytes, STOP. The slave increments its register
+ * pointer after each byte, as sensors and EEPROMs do.
+ * 
+ * @param slave_address The 7-bit address of the slave.
+ * @param reg The first register address.
+ * @param buf The bytes to write.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: A byte was not acknowledged, or asynchronous transactions are pending.
+ */
+Std_ReturnType I2C_Master_WriteRegs(uint8 slave_address, uint8 reg, const uint8 *buf, uint8 len);
+
+/**
+ * @brief Reads consecutive registers of a slave in one transfer.
+ * 
+ * START, address + W, register address, repeated START, address + R, then the bytes with
+ * an ACK after each one but the last, which is NACKed, and one STOP. A block of registers
+ * costs 3 header bytes instead of a full transfer per register.
+ * 
+ * @param slave_address The 7-bit address of the slave.
+ * @param reg The first register address.
+ * @param buf A buffer to store the bytes.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: A byte was not acknowledged, or asynchronous transactions are pending.
+ */
+Std_ReturnType I2C_Master_ReadRegs(uint8 slave_address, uint8 reg, uint8 *buf, uint8 len);
+
+#if I2C_CFG_ASYNC==I2C_CFG_FEATURE_ENABLE
+/**
+ * @brief Queues a master transaction and returns immediately.
+ * 
+ * I2C_ISR() runs the transaction as a state machine, one step per MSSP event: START done,
+ * byte sent and acknowledged, byte received, ACK sent, STOP done. After the STOP it calls the
+ * completion handler and starts the next queued transaction, so the main loop is not
+ * involved during the transfers. A NACK ends the transaction with a STOP, a bus collision
+ * ends it at once. The blocking master functions must not be used while transactions are
+ * pending.
+ * 
+ * The MSSP must be initialized with I2C_Master_Init() in I2C_MASTER_DEFINED_CLOCK mode.
+ * It can be called from the main loop and from handlers of both interrupt priorities, the
+ * slot is claimed with all interrupts off.
+ * 
+ * @param transaction A pointer to the transaction, copied into the queue.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The transaction was queued.
+ *         - E_NOT_OK: The queue is full, the MSSP isn't an I2C master, or invalid transaction.
+ */
+Std_ReturnType I2C_Async_Submit(const i2c_transaction_t *transaction);
+
+/**
+ * @brief Reports the number of transactions not completed yet, the running one included.
+ * 
+ * @param pending A pointer to store the number of transactions.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType I2C_Async_Pending(uint8 *pending);
+#endif
+
 #endif	/* I2C_H */
 
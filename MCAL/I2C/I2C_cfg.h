@@ -11,6 +11,13 @@
 /* -------------- Includes -------------- */
 
 /* -------------- Macro Declarations ------------- */
+#define I2C_CFG_FEATURE_ENABLE      1U
+#define I2C_CFG_FEATURE_DISABLE     0U
+
+//Interrupt-driven master transaction queue (I2C_Async_Submit()).
+#define I2C_CFG_ASYNC               I2C_CFG_FEATURE_ENABLE
+//Queued transactions, the running one included (power of two, 2 to 16).
+#define I2C_CFG_QUEUE_SIZE          4U
 
 /* -------------- Macro Functions Declarations -------------- */
 
@@ -11,9 +11,51 @@
 static void (*SPI_InterruptHandler)(void) = NULL;
 #endif
 
+#if SPI_CFG_ASYNC==SPI_CFG_FEATURE_ENABLE
+static spi_transaction_t spi_queue[SPI_CFG_QUEUE_SIZE];
+//Free running indexes, the slot at the tail is the running transaction.
+static volatile uint8 spi_queue_head = ZERO_INIT;   /* SPI_Async_Submit() */
+static volatile uint8 spi_queue_tail = ZERO_INIT;   /* SPI_ISR() */
+static volatile uint8 spi_async_active = ZERO_INIT;
+static volatile uint8 spi_bus_owned = ZERO_INIT;    /* A blocking transfer holds the bus */
+static uint16 spi_async_index = ZERO_INIT;          /* Byte in flight */
+
+static void SPI_Async_Start(void);
+static void SPI_Async_Byte(void);
+static Std_ReturnType SPI_Bus_Take(void);
+static void SPI_Bus_Free(void);
+#endif
+
 static Std_ReturnType inline SPI_Master_Mode_Select(const spi_t *_spi);
 static Std_ReturnType inline SPI_Master_Sample_Select(const spi_t *_spi);
 static Std_ReturnType inline SPI_Master_WaveForm_Select(const spi_t *_spi);
+static void SPI_Bus_Apply(const spi_device_t *device);
+#if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+static void SPI_Interrupt_Init(const spi_t *_spi);
+#endif
+
+#if SPI_CFG_SLAVE_ENGINE==SPI_CFG_FEATURE_ENABLE
+static volatile uint8 spi_slave_rx_buffer[SPI_CFG_SLAVE_RX_BUFFER_SIZE];
+//Free running indexes, each one is written by a single side only.
+static volatile uint8 spi_slave_rx_head = ZERO_INIT;    /* SPI_ISR() */
+static volatile uint8 spi_slave_rx_tail = ZERO_INIT;    /* SPI_Slave_Read() */
+static volatile uint8 spi_slave_active = ZERO_INIT;
+static uint8 spi_slave_framing = ZERO_INIT;             /* SS delimits the frames */
+static uint8 spi_slave_idle_byte = ZERO_INIT;
+static void (*SPI_Slave_FrameHandler)(uint8 rx_len) = NULL;
+//Response being sent, and the one set for the next frame.
+static const uint8 *spi_slave_tx_buf = NULL;
+static volatile uint8 spi_slave_tx_len = ZERO_INIT;
+static volatile uint8 spi_slave_tx_index = ZERO_INIT;
+static const uint8 *spi_slave_next_buf = NULL;
+static uint8 spi_slave_next_len = ZERO_INIT;
+static uint8 spi_slave_next_valid = ZERO_INIT;
+static volatile uint8 spi_slave_frame_len = ZERO_INIT;
+static volatile spi_slave_stats_t spi_slave_stats;
+
+static void SPI_Slave_Byte(void);
+static void SPI_Slave_Load_Response(void);
+#endif
 
 /**
  * @brief Initializes the SPI Master based on the provided configuration.
@@ -50,27 +92,7 @@ Std_ReturnType SPI_Master_Init(const spi_t *_spi)
         ret &= SPI_Master_WaveForm_Select(_spi);
         //Configure the interrupt
 #if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
-        SPI_INTERRUPT_ENABLE();
-        SPI_INTERRUPT_FLAG_CLEAR();
-        SPI_InterruptHandler = _spi->SPI_InterruptHandler;
-
-        //Interrupt priority configurations
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
-        INTERRUPT_PriorityLevelsEnable();
-        if(INTERRUPT_HIGH_PRIORITY == _spi->priority)
-        {
-            INTERRUPT_GlobalInterruptHighEnable();
-            SPI_INT_HIGH_PRIORITY();
-        }
-        else if(INTERRUPT_LOW_PRIORITY == _spi->priority)
-        {
-            INTERRUPT_GlobalInterruptLowEnable();
-            SPI_INT_LOW_PRIORITY();
-        }else{/* Nothing */}
-#else 
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
-#endif
+        SPI_Interrupt_Init(_spi);
 #endif
         //Enable SPI
         SPI_ENABLE();
@@ -172,6 +194,274 @@ Std_ReturnType SPI_Master_Transceiver(const uint8 data, pin_config_t *slave_sele
     return ret;
 }
 
+/**
+ * @brief A master exchanges a block of bytes with a slave, selected once for the whole block.
+ * 
+ * @param slave_select A pointer to the slave select pin, NULL when the caller drives it.
+ * @param tx_buf The bytes to send, NULL sends SPI_DUMMY_BYTE.
+ * @param rx_buf A buffer to store the received bytes, NULL discards them.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred, or asynchronous transactions are pending.
+ */
+Std_ReturnType SPI_Master_Transfer(const pin_config_t *slave_select, const uint8 *tx_buf,
+                                   uint8 *rx_buf, uint16 len)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_index = ZERO_INIT;
+#if SPI_CFG_ASYNC==SPI_CFG_FEATURE_ENABLE
+    //Held for this transfer only when the caller didn't acquire the bus
+    uint8 l_take = (uint8)(ZERO_INIT == spi_bus_owned);
+
+    if(l_take && E_OK != SPI_Bus_Take())
+    {
+        //SSPBUF belongs to SPI_ISR() until the queue is empty
+        ret = E_NOT_OK;
+    }
+    else
+#endif
+    {
+        if(NULL != slave_select)
+        {
+            ret = gpio_pin_write(slave_select, GPIO_LOW);
+        }else{/* Nothing */}
+        //Start from an empty buffer, a stale BF would end the first wait early
+        (void)SSPBUF;
+        SPI_TRANSMIT_COLLISION_CLEAR();
+        //One loop per buffer combination keeps the per-byte path free of NULL tests
+        if(NULL != tx_buf && NULL != rx_buf)
+        {
+            for(l_index = 0; l_index < len; l_index++)
+            {
+                SSPBUF = tx_buf[l_index];
+                while(!SPI_RECEIVE_STATUS());
+                rx_buf[l_index] = SSPBUF;
+            }
+        }
+        else if(NULL != tx_buf)
+        {
+            for(l_index = 0; l_index < len; l_index++)
+            {
+                SSPBUF = tx_buf[l_index];
+                while(!SPI_RECEIVE_STATUS());
+                //Reading SSPBUF clears BF and avoids SSPOV
+                (void)SSPBUF;
+            }
+        }
+        else if(NULL != rx_buf)
+        {
+            for(l_index = 0; l_index < len; l_index++)
+            {
+                SSPBUF = SPI_DUMMY_BYTE;
+                while(!SPI_RECEIVE_STATUS());
+                rx_buf[l_index] = SSPBUF;
+            }
+        }
+        else
+        {
+            for(l_index = 0; l_index < len; l_index++)
+            {
+                SSPBUF = SPI_DUMMY_BYTE;
+                while(!SPI_RECEIVE_STATUS());
+                (void)SSPBUF;
+            }
+        }
+        if(NULL != slave_select)
+        {
+            ret &= gpio_pin_write(slave_select, GPIO_HIGH);
+        }else{/* Nothing */}
+#if SPI_CFG_ASYNC==SPI_CFG_FEATURE_ENABLE
+        if(l_take)
+        {
+            SPI_Bus_Free();
+        }else{/* Nothing */}
+#endif
+    }
+    return ret;
+}
+
+/**
+ * @brief Prepares a slave device: computes its register images and initializes its slave select pin.
+ * 
+ * @param device A pointer to the device to fill.
+ * @param _spi A pointer to the SPI configuration of this slave (mode, waveform, sample).
+ * @param slave_select A pointer to the slave select pin, initialized as an output (high).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Device_Init(spi_device_t *device, const spi_t *_spi, const pin_config_t *slave_select)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == device || NULL == _spi || NULL == slave_select || _spi->mode > SPI_MASTER_TMR2_DIV_2)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //SSPM is the mode, the waveform gives CKP and CKE
+        device->sspcon1 = (uint8)(SPI_SSPCON1_SSPEN | (uint8)_spi->mode);
+        device->sspstat = (SPI_MASTER_SAMPLE_END_CFG == _spi->master_sample) ? SPI_SSPSTAT_SMP : 0U;
+        switch (_spi->master_waveform)
+        {
+            case SPI_CLK_IDLE_LOW_TX_LEADING_RISING:    break;
+            case SPI_CLK_IDLE_HIGH_TX_LEADING_FALLING:  device->sspcon1 |= SPI_SSPCON1_CKP; break;
+            case SPI_CLK_IDLE_LOW_TX_TRAILING_FALLING:  device->sspstat |= SPI_SSPSTAT_CKE; break;
+            case SPI_CLK_IDLE_HIGH_TX_TRAILING_RISING:
+                device->sspcon1 |= SPI_SSPCON1_CKP;
+                device->sspstat |= SPI_SSPSTAT_CKE;
+                break;
+            default: ret = E_NOT_OK; break;
+        }
+        //Deselected until a transfer
+        device->slave_select = *slave_select;
+        device->slave_select.direction = GPIO_DIRECTION_OUTPUT;
+        device->slave_select.logic = GPIO_HIGH;
+        ret &= gpio_pin_initialize(&device->slave_select);
+    }
+    return ret;
+}
+
+/**
+ * @brief Holds the bus for blocking transfers and configures it for a slave device.
+ * 
+ * @param device A pointer to the slave device.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL device, or asynchronous transactions are pending.
+ */
+Std_ReturnType SPI_Bus_Acquire(const spi_device_t *device)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == device)
+    {
+        ret = E_NOT_OK;
+    }
+#if SPI_CFG_ASYNC==SPI_CFG_FEATURE_ENABLE
+    else if(E_OK != SPI_Bus_Take())
+    {
+        //SPI_ISR() reconfigures the bus for the queued transactions
+        ret = E_NOT_OK;
+    }
+#endif
+    else
+    {
+        SPI_Bus_Apply(device);
+    }
+    return ret;
+}
+
+/**
+ * @brief Ends the blocking transfers started by SPI_Bus_Acquire(), queued transactions start.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Bus_Release(void)
+{
+    Std_ReturnType ret = E_OK;
+
+#if SPI_CFG_ASYNC==SPI_CFG_FEATURE_ENABLE
+    SPI_Bus_Free();
+#endif
+    return ret;
+}
+
+/**
+ * @brief Exchanges a block of bytes with a slave device, see SPI_Master_Transfer().
+ * 
+ * @param device A pointer to the slave device.
+ * @param tx_buf The bytes to send, NULL sends SPI_DUMMY_BYTE.
+ * @param rx_buf A buffer to store the received bytes, NULL discards them.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred, or asynchronous transactions are pending.
+ */
+Std_ReturnType SPI_Device_Transfer(const spi_device_t *device, const uint8 *tx_buf, uint8 *rx_buf, uint16 len)
+{
+    Std_ReturnType ret = E_OK;
+
+    ret = SPI_Bus_Acquire(device);
+    if(E_OK == ret)
+    {
+        ret = SPI_Master_Transfer(&device->slave_select, tx_buf, rx_buf, len);
+        ret &= SPI_Bus_Release();
+    }else{/* Nothing */}
+    return ret;
+}
+
+#if SPI_CFG_ASYNC==SPI_CFG_FEATURE_ENABLE
+/**
+ * @brief Queues a master transaction and returns immediately.
+ * 
+ * @param transaction A pointer to the transaction, copied into the queue.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The transaction was queued.
+ *         - E_NOT_OK: The queue is full, the MSSP isn't an SPI master, or invalid transaction.
+ */
+Std_ReturnType SPI_Async_Submit(const spi_transaction_t *transaction)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_global_interrupt_status = INTCONbits.GIE;
+    uint8 l_head = ZERO_INIT;
+
+    if(NULL == transaction || ZERO_INIT == transaction->len || SSPCON1bits.SSPM > SPI_MASTER_TMR2_DIV_2)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //Submitters may run at both interrupt priorities, claim the slot with all interrupts off
+        INTCONbits.GIE = 0;
+        l_head = spi_queue_head;
+        if((uint8)(l_head - spi_queue_tail) >= SPI_CFG_QUEUE_SIZE)
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            spi_queue[l_head & SPI_QUEUE_MASK] = *transaction;
+            spi_queue_head = (uint8)(l_head + 1);
+            //Start the engine if it is idle, a blocking owner starts it on release
+            if(ZERO_INIT == spi_async_active && ZERO_INIT == spi_bus_owned)
+            {
+                SPI_Async_Start();
+            }else{/* Nothing */}
+        }
+        INTCONbits.GIE = l_global_interrupt_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief Reports the number of transactions not completed yet, the running one included.
+ * 
+ * @param pending A pointer to store the number of transactions.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Async_Pending(uint8 *pending)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == pending)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *pending = (uint8)(spi_queue_head - spi_queue_tail);
+    }
+    return ret;
+}
+#endif
+
 /**
  * @brief Receives the data from a slave in a blocking manner.
  *  disables the trasmission (Master in only Receive mode).
@@ -206,6 +496,192 @@ Std_ReturnType SPI_Master_Recieve(uint8 *Rec_data, pin_config_t *slave_select)
     return ret;
 }
 
+#if SPI_CFG_SLAVE_ENGINE==SPI_CFG_FEATURE_ENABLE
+/**
+ * @brief Initializes the SPI slave and its interrupt-driven data path.
+ * 
+ * @param _slave A pointer to the SPI Slave Engine Configurations Structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Slave_Engine_Init(const spi_slave_t *_slave)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == _slave)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        SPI_INTERRUPT_DISABLE();
+        spi_slave_active = ZERO_INIT;
+        spi_slave_rx_head = ZERO_INIT;
+        spi_slave_rx_tail = ZERO_INIT;
+        spi_slave_framing = (uint8)(SPI_SLAVE_SS_ENABLED == _slave->spi.mode);
+        spi_slave_idle_byte = _slave->idle_byte;
+        SPI_Slave_FrameHandler = _slave->SPI_Slave_FrameHandler;
+        spi_slave_tx_len = ZERO_INIT;
+        spi_slave_tx_index = ZERO_INIT;
+        spi_slave_next_valid = ZERO_INIT;
+        spi_slave_frame_len = ZERO_INIT;
+        spi_slave_stats.rx_frames = ZERO_INIT;
+        spi_slave_stats.rx_overflows = ZERO_INIT;
+        spi_slave_stats.rx_dropped = ZERO_INIT;
+        spi_slave_stats.tx_collisions = ZERO_INIT;
+        ret = SPI_Slave_Init(&_slave->spi);
+        if(E_OK == ret)
+        {
+            //Empty SSPBUF and clear the errors, the first byte out is the idle byte
+            (void)SSPBUF;
+            SPI_RECEIVER_OVERFLOW_CLEAR();
+            SPI_TRANSMIT_COLLISION_CLEAR();
+            SSPBUF = spi_slave_idle_byte;
+            spi_slave_active = 1;
+            SPI_Interrupt_Init(&_slave->spi);
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief Sets the bytes sent to the master during the next frame.
+ * 
+ * @param buf The response bytes (can be NULL when len is 0).
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: The engine isn't initialized, or NULL buffer.
+ */
+Std_ReturnType SPI_Slave_Set_Response(const uint8 *buf, uint8 len)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(ZERO_INIT == spi_slave_active || (NULL == buf && ZERO_INIT != len))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        SPI_INTERRUPT_DISABLE();
+        spi_slave_next_buf = buf;
+        spi_slave_next_len = len;
+        spi_slave_next_valid = 1;
+        //Between frames SSPBUF can be replaced, the MSSP is idle while SS is high
+        if(ZERO_INIT == spi_slave_framing || (ZERO_INIT == spi_slave_frame_len && PORTAbits.RA5))
+        {
+            SPI_Slave_Load_Response();
+        }else{/* Nothing */}
+        SPI_INTERRUPT_ENABLE();
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads received bytes from the RX ring.
+ * 
+ * @param buf A buffer to store the bytes.
+ * @param len Size of the buffer.
+ * @param read_len A pointer to store the number of bytes read (0 when the ring is empty).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Slave_Read(uint8 *buf, uint8 len, uint8 *read_len)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_tail = spi_slave_rx_tail;
+    uint8 l_count = ZERO_INIT;
+
+    if(NULL == buf || NULL == read_len)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        while(l_count < len && l_tail != spi_slave_rx_head)
+        {
+            buf[l_count] = spi_slave_rx_buffer[l_tail & SPI_SLAVE_RX_BUFFER_MASK];
+            l_tail++;
+            l_count++;
+        }
+        //Release the slots only after they have been copied
+        spi_slave_rx_tail = l_tail;
+        *read_len = l_count;
+    }
+    return ret;
+}
+
+/**
+ * @brief Closes the frame once SS is high again, call it from the main loop.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: The engine isn't initialized.
+ */
+Std_ReturnType SPI_Slave_Tasks(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_len = ZERO_INIT;
+
+    if(ZERO_INIT == spi_slave_active)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(spi_slave_framing && spi_slave_frame_len && PORTAbits.RA5)
+    {
+        SPI_INTERRUPT_DISABLE();
+        l_len = spi_slave_frame_len;
+        spi_slave_frame_len = ZERO_INIT;
+        spi_slave_stats.rx_frames++;
+        //The response of the next frame, or the idle byte
+        if(ZERO_INIT == spi_slave_next_valid)
+        {
+            spi_slave_next_len = ZERO_INIT;
+            spi_slave_next_valid = 1;
+        }else{/* Nothing */}
+        SPI_Slave_Load_Response();
+        SPI_INTERRUPT_ENABLE();
+        if(SPI_Slave_FrameHandler)
+        {
+            SPI_Slave_FrameHandler(l_len);
+        }else{/* Nothing */}
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief Retrieves the slave statistics.
+ * 
+ * @param stats A pointer to store the statistics.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Slave_Get_Stats(spi_slave_stats_t *stats)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_int_status = PIE1bits.SSPIE;
+
+    if(NULL == stats)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //The counters are updated by SPI_ISR(), copy them atomically
+        SPI_INTERRUPT_DISABLE();
+        stats->rx_frames = spi_slave_stats.rx_frames;
+        stats->rx_overflows = spi_slave_stats.rx_overflows;
+        stats->rx_dropped = spi_slave_stats.rx_dropped;
+        stats->tx_collisions = spi_slave_stats.tx_collisions;
+        PIE1bits.SSPIE = l_int_status;
+    }
+    return ret;
+}
+#endif
+
 /**
  * @brief De-Initializes the SPI module.
  * 
@@ -226,6 +702,9 @@ Std_ReturnType SPI_DiInit(const spi_t *_spi)
         SPI_DISABLE();
 #if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
         SPI_INTERRUPT_DISABLE();
+#endif
+#if SPI_CFG_SLAVE_ENGINE==SPI_CFG_FEATURE_ENABLE
+        spi_slave_active = ZERO_INIT;
 #endif
     }
     return ret;
@@ -239,6 +718,20 @@ void SPI_ISR(void)
 #if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
     //MSSP SPI interrupt occurred, the flag must be cleared.
     SPI_INTERRUPT_FLAG_CLEAR();
+#if SPI_CFG_SLAVE_ENGINE==SPI_CFG_FEATURE_ENABLE
+    if(spi_slave_active)
+    {
+        SPI_Slave_Byte();
+    }
+    else
+#endif
+#if SPI_CFG_ASYNC==SPI_CFG_FEATURE_ENABLE
+    if(spi_async_active)
+    {
+        SPI_Async_Byte();
+    }
+    else
+#endif
     //CallBack func gets called every time this ISR executes.
     if(SPI_InterruptHandler)
     {
@@ -247,6 +740,210 @@ void SPI_ISR(void)
 #endif    
 }
 
+#if SPI_CFG_ASYNC==SPI_CFG_FEATURE_ENABLE
+/**
+ * @brief Selects the slave of the transaction at the queue tail and sends its first byte.
+ * 
+ */
+static void SPI_Async_Start(void)
+{
+    const spi_transaction_t *l_transaction = &spi_queue[spi_queue_tail & SPI_QUEUE_MASK];
+
+    spi_async_active = 1;
+    spi_async_index = ZERO_INIT;
+    if(l_transaction->device)
+    {
+        SPI_Bus_Apply(l_transaction->device);
+        gpio_pin_write(&l_transaction->device->slave_select, GPIO_LOW);
+    }else{/* Nothing */}
+    //Clear a stale BF, then the interrupt of this first byte drives the rest
+    (void)SSPBUF;
+    SPI_TRANSMIT_COLLISION_CLEAR();
+    SSPBUF = (l_transaction->tx_buf) ? l_transaction->tx_buf[0] : SPI_DUMMY_BYTE;
+}
+
+/**
+ * @brief A byte was exchanged, SPI_ISR() context.
+ * 
+ */
+static void SPI_Async_Byte(void)
+{
+    const spi_transaction_t *l_transaction = &spi_queue[spi_queue_tail & SPI_QUEUE_MASK];
+    void (*l_handler)(void *context) = NULL;
+    void *l_context = NULL;
+    uint8 l_data = SSPBUF;
+
+    if(l_transaction->rx_buf)
+    {
+        l_transaction->rx_buf[spi_async_index] = l_data;
+    }else{/* Nothing */}
+    spi_async_index++;
+    if(spi_async_index < l_transaction->len)
+    {
+        SSPBUF = (l_transaction->tx_buf) ? l_transaction->tx_buf[spi_async_index] : SPI_DUMMY_BYTE;
+    }
+    else
+    {
+        if(l_transaction->device)
+        {
+            gpio_pin_write(&l_transaction->device->slave_select, GPIO_HIGH);
+        }else{/* Nothing */}
+        //Free the slot before the handler, it may submit the next transaction
+        l_handler = l_transaction->SPI_CompleteHandler;
+        l_context = l_transaction->context;
+        spi_queue_tail = (uint8)(spi_queue_tail + 1);
+        spi_async_active = ZERO_INIT;
+        if(l_handler)
+        {
+            l_handler(l_context);
+        }else{/* Nothing */}
+        if(ZERO_INIT == spi_async_active && ZERO_INIT == spi_bus_owned && spi_queue_tail != spi_queue_head)
+        {
+            SPI_Async_Start();
+        }else{/* Nothing */}
+    }
+}
+
+/**
+ * @brief Marks the bus as held by a blocking transfer, E_NOT_OK while a transaction runs.
+ * 
+ * The flag is set before the engine is checked: a submission from an interrupt then either
+ * started the engine already, or only queues.
+ */
+static Std_ReturnType SPI_Bus_Take(void)
+{
+    Std_ReturnType ret = E_OK;
+
+    spi_bus_owned = 1;
+    if(spi_async_active)
+    {
+        //The engine may have ended meanwhile without starting the next transaction
+        SPI_Bus_Free();
+        ret = E_NOT_OK;
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief Hands the bus back and starts the transactions queued meanwhile.
+ * 
+ * Interrupts are off so a submission from an interrupt can't start the engine twice.
+ */
+static void SPI_Bus_Free(void)
+{
+    uint8 l_global_interrupt_status = INTCONbits.GIE;
+
+    INTCONbits.GIE = 0;
+    spi_bus_owned = ZERO_INIT;
+    if(ZERO_INIT == spi_async_active && spi_queue_tail != spi_queue_head)
+    {
+        SPI_Async_Start();
+    }else{/* Nothing */}
+    INTCONbits.GIE = l_global_interrupt_status;
+}
+#endif
+
+#if SPI_CFG_SLAVE_ENGINE==SPI_CFG_FEATURE_ENABLE
+/**
+ * @brief A byte was exchanged with the master, SPI_ISR() context.
+ * 
+ */
+static void SPI_Slave_Byte(void)
+{
+    uint8 l_data = SSPBUF;
+    uint8 l_head = spi_slave_rx_head;
+    uint8 l_index = spi_slave_tx_index;
+
+    //Load the next response byte first, the master may clock it right away
+    if(l_index < spi_slave_tx_len)
+    {
+        SSPBUF = spi_slave_tx_buf[l_index];
+        spi_slave_tx_index = (uint8)(l_index + 1);
+    }
+    else
+    {
+        SSPBUF = spi_slave_idle_byte;
+    }
+    if(SPI_TRANSMIT_COLLISION_CHECK())
+    {
+        SPI_TRANSMIT_COLLISION_CLEAR();
+        spi_slave_stats.tx_collisions++;
+    }else{/* Nothing */}
+    if(SPI_RECEIVER_OVERFLOW_CHECK())
+    {
+        SPI_RECEIVER_OVERFLOW_CLEAR();
+        spi_slave_stats.rx_overflows++;
+    }else{/* Nothing */}
+    if((uint8)(l_head - spi_slave_rx_tail) >= SPI_CFG_SLAVE_RX_BUFFER_SIZE)
+    {
+        spi_slave_stats.rx_dropped++;
+    }
+    else
+    {
+        spi_slave_rx_buffer[l_head & SPI_SLAVE_RX_BUFFER_MASK] = l_data;
+        spi_slave_rx_head = (uint8)(l_head + 1);
+    }
+    if(spi_slave_frame_len < 0xFFU)
+    {
+        spi_slave_frame_len++;
+    }else{/* Nothing */}
+}
+
+/**
+ * @brief Makes the next response current and loads its first byte, SPI interrupt disabled.
+ * 
+ */
+static void SPI_Slave_Load_Response(void)
+{
+    spi_slave_tx_buf = spi_slave_next_buf;
+    spi_slave_tx_len = spi_slave_next_len;
+    spi_slave_tx_index = ZERO_INIT;
+    spi_slave_next_valid = ZERO_INIT;
+    if(spi_slave_framing)
+    {
+        if(spi_slave_tx_len)
+        {
+            SSPBUF = spi_slave_tx_buf[0];
+            spi_slave_tx_index = 1;
+        }
+        else
+        {
+            SSPBUF = spi_slave_idle_byte;
+        }
+    }else{/* The byte in SSPBUF goes first, SPI_ISR() continues with the response */}
+}
+#endif
+
+#if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Helper function to configure the MSSP interrupt
+ */
+static void SPI_Interrupt_Init(const spi_t *_spi)
+{
+    SPI_INTERRUPT_ENABLE();
+    SPI_INTERRUPT_FLAG_CLEAR();
+    SPI_InterruptHandler = _spi->SPI_InterruptHandler;
+
+    //Interrupt priority configurations
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+    INTERRUPT_PriorityLevelsEnable();
+    if(INTERRUPT_HIGH_PRIORITY == _spi->priority)
+    {
+        INTERRUPT_GlobalInterruptHighEnable();
+        SPI_INT_HIGH_PRIORITY();
+    }
+    else if(INTERRUPT_LOW_PRIORITY == _spi->priority)
+    {
+        INTERRUPT_GlobalInterruptLowEnable();
+        SPI_INT_LOW_PRIORITY();
+    }else{/* Nothing */}
+#else 
+    INTERRUPT_GlobalInterruptEnable();
+    INTERRUPT_PeripheralInterruptEnable();
+#endif
+}
+#endif
+
 /**
  * @brief Helper function to Select Master Mode  
  *   Options:
@@ -301,4 +998,22 @@ static Std_ReturnType inline SPI_Master_WaveForm_Select(const spi_t *_spi)
         default: ret = E_NOT_OK; break;
     }
     return ret;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Helper function to write the register images of a device that differ from the bus state
+ */
+static void SPI_Bus_Apply(const spi_device_t *device)
+{
+    if((SSPCON1 & SPI_SSPCON1_CFG_MASK) != device->sspcon1)
+    {
+        //Mode and clock polarity change with the MSSP disabled
+        SSPCON1 = (uint8)(device->sspcon1 & (uint8)~SPI_SSPCON1_SSPEN);
+        SSPSTAT = device->sspstat;
+        SSPCON1 = device->sspcon1;
+    }
+    else if((SSPSTAT & SPI_SSPSTAT_CFG_MASK) != device->sspstat)
+    {
+        SSPSTAT = device->sspstat;
+    }else{/* Nothing */}
+}
@@ -28,6 +28,38 @@
 
 #define SPI_WRITE_COLLISION_OCCURRED        1  
 #define SPI_WRITE_COLLISION_UNOCCURRED      0  
+
+//Sent by SPI_Master_Transfer() when there is no TX buffer (idle high MOSI).
+#define SPI_DUMMY_BYTE      0xFFU
+
+//Configuration bits of the register images in spi_device_t.
+#define SPI_SSPCON1_SSPEN           0x20U
+#define SPI_SSPCON1_CKP             0x10U
+#define SPI_SSPCON1_CFG_MASK        0x3FU   /* SSPEN, CKP, SSPM, WCOL and SSPOV are status */
+#define SPI_SSPSTAT_SMP             0x80U
+#define SPI_SSPSTAT_CKE             0x40U
+#define SPI_SSPSTAT_CFG_MASK        0xC0U   /* The other bits are read-only */
+
+#if SPI_CFG_ASYNC==SPI_CFG_FEATURE_ENABLE
+#if SPI_INTERRUPT_ENABLE_FEATURE!=INTERRUPT_FEATURE_ENABLE
+#error "SPI_CFG_ASYNC needs SPI_INTERRUPT_ENABLE_FEATURE"
+#endif
+#if (SPI_CFG_QUEUE_SIZE < 2) || (SPI_CFG_QUEUE_SIZE > 16) || (SPI_CFG_QUEUE_SIZE & (SPI_CFG_QUEUE_SIZE - 1))
+#error "SPI_CFG_QUEUE_SIZE must be a power of two between 2 and 16"
+#endif
+#define SPI_QUEUE_MASK      (SPI_CFG_QUEUE_SIZE - 1U)
+#endif
+
+#if SPI_CFG_SLAVE_ENGINE==SPI_CFG_FEATURE_ENABLE
+#if SPI_INTERRUPT_ENABLE_FEATURE!=INTERRUPT_FEATURE_ENABLE
+#error "SPI_CFG_SLAVE_ENGINE needs SPI_INTERRUPT_ENABLE_FEATURE"
+#endif
+#if (SPI_CFG_SLAVE_RX_BUFFER_SIZE < 2) || (SPI_CFG_SLAVE_RX_BUFFER_SIZE > 128) || \
+    (SPI_CFG_SLAVE_RX_BUFFER_SIZE & (SPI_CFG_SLAVE_RX_BUFFER_SIZE - 1))
+#error "SPI_CFG_SLAVE_RX_BUFFER_SIZE must be a power of two between 2 and 128"
+#endif
+#define SPI_SLAVE_RX_BUFFER_MASK    (SPI_CFG_SLAVE_RX_BUFFER_SIZE - 1U)
+#endif
 /* -------------- Macro Functions Declarations -------------- */
 //SPI Enable or Disable.
 #define SPI_ENABLE()     (SSPCON1bits.SSPEN = 1)
@@ -102,6 +134,60 @@ typedef struct
 #endif 
 }spi_t;
 
+/**
+ * @brief SPI Slave Device, filled by SPI_Device_Init()
+ * 
+ * Holds the slave select pin and the SSPCON1/SSPSTAT values for the clock rate, waveform
+ * and sample point of this slave, so switching the bus between slaves is a compare and at
+ * most two register writes.
+ */
+typedef struct
+{
+    pin_config_t slave_select;
+    uint8 sspcon1;
+    uint8 sspstat;
+}spi_device_t;
+
+#if SPI_CFG_ASYNC==SPI_CFG_FEATURE_ENABLE
+/**
+ * @brief SPI Transaction, copied into the queue by SPI_Async_Submit()
+ * 
+ * The buffers are used by SPI_ISR() until the completion handler runs, they must stay valid.
+ */
+typedef struct
+{
+    const spi_device_t *device;         /* Bus configuration and slave select (NULL keeps the bus as is) */
+    const uint8 *tx_buf;                /* NULL sends SPI_DUMMY_BYTE */
+    uint8 *rx_buf;                      /* NULL discards the received bytes */
+    uint16 len;
+    void (* SPI_CompleteHandler)(void *context);    /* Called in SPI_ISR() (can be NULL) */
+    void *context;
+}spi_transaction_t;
+#endif
+
+#if SPI_CFG_SLAVE_ENGINE==SPI_CFG_FEATURE_ENABLE
+/**
+ * @brief SPI Slave Engine Configurations Structure
+ */
+typedef struct
+{
+    spi_t spi;                      /* SPI_SLAVE_SS_ENABLED or SPI_SLAVE_SS_DISABLED, waveform, priority */
+    uint8 idle_byte;                /* Sent once the response is exhausted */
+    void (* SPI_Slave_FrameHandler)(uint8 rx_len);  /* Called by SPI_Slave_Tasks() after each frame (can be NULL) */
+}spi_slave_t;
+
+/**
+ * @brief SPI Slave Statistics
+ */
+typedef struct
+{
+    uint16 rx_frames;               /* Frames closed by SS going high */
+    uint16 rx_overflows;            /* SSPOV events, a byte arrived before the previous one was read */
+    uint16 rx_dropped;              /* Bytes lost because the RX ring was full */
+    uint16 tx_collisions;           /* WCOL events, a response byte was loaded too late */
+}spi_slave_stats_t;
+#endif
+
 /* -------------- Software Interfaces Declarations -------------- */
 /**
  * @brief Initializes the SPI Master based on the provided configuration.
@@ -149,6 +235,112 @@ uint8 SPI_Transfer_data(uint8 data);
  */
 Std_ReturnType SPI_Master_Transceiver(const uint8 data, pin_config_t *slave_select, uint8 *rec_data);
 
+/**
+ * @brief A master exchanges a block of bytes with a slave, selected once for the whole block.
+ * 
+ * The slave select pin is driven low, then each byte is written to SSPBUF and read back as
+ * soon as BF is set, and the pin is driven high after the last byte. The pin must already
+ * be initialized as an output (high). At SPI_MASTER_FOSC_DIV_4 a byte lasts 8 instruction
+ * cycles on the wire, so the loop overhead, not the clock, sets the throughput.
+ * 
+ * @param slave_select A pointer to the slave select pin, NULL when the caller drives it.
+ * @param tx_buf The bytes to send, NULL sends SPI_DUMMY_BYTE.
+ * @param rx_buf A buffer to store the received bytes, NULL discards them.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred, or asynchronous transactions are pending.
+ */
+Std_ReturnType SPI_Master_Transfer(const pin_config_t *slave_select, const uint8 *tx_buf,
+                                   uint8 *rx_buf, uint16 len);
+
+/**
+ * @brief Prepares a slave device: computes its register images and initializes its slave select pin.
+ * 
+ * Only master modes are accepted, SPI_Master_Init() must be called once for the pins.
+ * 
+ * @param device A pointer to the device to fill.
+ * @param _spi A pointer to the SPI configuration of this slave (mode, waveform, sample).
+ * @param slave_select A pointer to the slave select pin, initialized as an output (high).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Device_Init(spi_device_t *device, const spi_t *_spi, const pin_config_t *slave_select);
+
+/**
+ * @brief Holds the bus for blocking transfers and configures it for a slave device.
+ * 
+ * Only the registers that differ are written: SSPCON1 changes are written with SSPEN
+ * cleared first, as the MSSP requires for a new mode or clock polarity; SSPSTAT is
+ * written alone when only the clock edge or the sample point differ.
+ * 
+ * @param device A pointer to the slave device.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL device, or asynchronous transactions are pending.
+ */
+Std_ReturnType SPI_Bus_Acquire(const spi_device_t *device);
+
+/**
+ * @brief Ends the blocking transfers started by SPI_Bus_Acquire(), queued transactions start.
+ * 
+ * Between SPI_Bus_Acquire() and this call SPI_Async_Submit() only queues, so a driver can
+ * keep its slave selected across several SPI_Master_Transfer() calls while transactions
+ * are submitted from interrupts.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Bus_Release(void);
+
+/**
+ * @brief Exchanges a block of bytes with a slave device, see SPI_Master_Transfer().
+ * 
+ * @param device A pointer to the slave device.
+ * @param tx_buf The bytes to send, NULL sends SPI_DUMMY_BYTE.
+ * @param rx_buf A buffer to store the received bytes, NULL discards them.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred, or asynchronous transactions are pending.
+ */
+Std_ReturnType SPI_Device_Transfer(const spi_device_t *device, const uint8 *tx_buf, uint8 *rx_buf, uint16 len);
+
+#if SPI_CFG_ASYNC==SPI_CFG_FEATURE_ENABLE
+/**
+ * @brief Queues a master transaction and returns immediately.
+ * 
+ * Each transaction configures the bus for its device when it starts (SPI_Bus_Acquire()).
+ * SPI_ISR() moves one byte per interrupt: it stores the received byte, loads the next one
+ * into SSPBUF and, after the last byte, releases the slave select pin, calls the completion
+ * handler and starts the next queued transaction. The main loop isn't involved between
+ * transactions. The blocking transfer functions must not be used while transactions are
+ * pending, SPI_Master_Transfer() refuses to run then. While a blocking transfer holds the
+ * bus (SPI_Master_Transfer(), or SPI_Bus_Acquire() up to SPI_Bus_Release()) the
+ * transaction is only queued, it starts when the bus is released. It can be called from the
+ * main loop and from handlers of both interrupt priorities, the slot is claimed with all
+ * interrupts off.
+ * 
+ * @param transaction A pointer to the transaction, copied into the queue.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The transaction was queued.
+ *         - E_NOT_OK: The queue is full, the MSSP isn't an SPI master, or invalid transaction.
+ */
+Std_ReturnType SPI_Async_Submit(const spi_transaction_t *transaction);
+
+/**
+ * @brief Reports the number of transactions not completed yet, the running one included.
+ * 
+ * @param pending A pointer to store the number of transactions.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Async_Pending(uint8 *pending);
+#endif
+
 /**
  * @brief Receives the data from a slave in a blocking manner and 
  *  disables the trasmission (Master in only Receive mode).
@@ -161,6 +353,76 @@ Std_ReturnType SPI_Master_Transceiver(const uint8 data, pin_config_t *slave_sele
  */
 Std_ReturnType SPI_Master_Recieve(uint8 *Rec_data, pin_config_t *slave_select);
 
+#if SPI_CFG_SLAVE_ENGINE==SPI_CFG_FEATURE_ENABLE
+/**
+ * @brief Initializes the SPI slave and its interrupt-driven data path.
+ * 
+ * SPI_ISR() reads every received byte into the RX ring and loads SSPBUF with the next
+ * response byte right away, within the time the master leaves between bytes. Use the high
+ * priority for the SPI interrupt so that time covers the interrupt latency.
+ * With SPI_SLAVE_SS_ENABLED, SS (RA5, set as digital with ADCON1) delimits the frames: the
+ * MSSP ignores the clock while SS is high, and SPI_Slave_Tasks() closes the frame when it
+ * sees SS high after some bytes.
+ * 
+ * @param _slave A pointer to the SPI Slave Engine Configurations Structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Slave_Engine_Init(const spi_slave_t *_slave);
+
+/**
+ * @brief Sets the bytes sent to the master during the next frame.
+ * 
+ * Outside a frame the response is loaded at once, otherwise when the current frame ends.
+ * It is sent once, then the idle byte follows. Without SS framing the response is loaded
+ * at once and starts after the byte already in SSPBUF. The buffer must stay valid until
+ * the frame ends.
+ * 
+ * @param buf The response bytes (can be NULL when len is 0).
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: The engine isn't initialized, or NULL buffer.
+ */
+Std_ReturnType SPI_Slave_Set_Response(const uint8 *buf, uint8 len);
+
+/**
+ * @brief Reads received bytes from the RX ring.
+ * 
+ * @param buf A buffer to store the bytes.
+ * @param len Size of the buffer.
+ * @param read_len A pointer to store the number of bytes read (0 when the ring is empty).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Slave_Read(uint8 *buf, uint8 len, uint8 *read_len);
+
+/**
+ * @brief Closes the frame once SS is high again, call it from the main loop.
+ * 
+ * RA5 has no interrupt, so the frame end is seen here: call it more often than the gap
+ * the master leaves between frames, or from an INTx handler when SS is also wired to an
+ * INTx pin. The frame handler gets the number of bytes of the frame (255 at most).
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: The engine isn't initialized.
+ */
+Std_ReturnType SPI_Slave_Tasks(void);
+
+/**
+ * @brief Retrieves the slave statistics.
+ * 
+ * @param stats A pointer to store the statistics.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Slave_Get_Stats(spi_slave_stats_t *stats);
+#endif
+
 /**
  * @brief De-Initializes the SPI module.
  * 
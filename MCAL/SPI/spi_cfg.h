@@ -11,6 +11,18 @@
 
 
 /* -------------- Macro Declarations ------------- */
+#define SPI_CFG_FEATURE_ENABLE      1U
+#define SPI_CFG_FEATURE_DISABLE     0U
+
+//Interrupt-driven master transaction queue (SPI_Async_Submit()).
+#define SPI_CFG_ASYNC               SPI_CFG_FEATURE_ENABLE
+//Queued transactions, the running one included (power of two, 2 to 16).
+#define SPI_CFG_QUEUE_SIZE          4U
+
+//Interrupt-driven slave with an RX ring and preloaded responses (SPI_Slave_Engine_Init()).
+#define SPI_CFG_SLAVE_ENGINE        SPI_CFG_FEATURE_ENABLE
+//RX ring size in bytes (power of two, 2 to 128).
+#define SPI_CFG_SLAVE_RX_BUFFER_SIZE    32U
 
 /* -------------- Macro Functions Declarations -------------- */
 
@@ -12,11 +12,74 @@ void (*EUSART_TXInterruptHandler)(void) = NULL;
 void (*EUSART_RXInterruptHandler)(void) = NULL;
 void (*EUSART_FramingErrorHandler)(void) = NULL;
 
-static inline void Eusart_Baudrate_Calc(const usart_t *_usart);
+static uint32 eusart_achieved_baud = ZERO_INIT;
+static sint32 eusart_baud_error_ppm = ZERO_INIT;
+
+static Std_ReturnType Eusart_Baudrate_Calc(const usart_t *_usart);
+static Std_ReturnType Eusart_Brg_Compute(uint32 baudrate, uint8 divisor, uint8 brg16,
+                                         uint16 *brg, sint32 *error_ppm);
+static usart_baudrate_gen_t Eusart_Best_Async_Mode(uint32 baudrate);
+static uint8 Eusart_Async_Divisor(void);
+static void Eusart_Brg_Apply(uint16 brg, sint32 error_ppm);
 static inline void Eusart_Async_Tx_Init(const usart_t *_usart);
 static inline void Eusart_Async_Rx_Init(const usart_t *_usart);
 static inline void Eusart_Async_Rx_Restart(void);
 
+#if EUSART_CFG_AUTOBAUD==EUSART_CFG_FEATURE_ENABLE
+static const uint32 eusart_standard_rates[] = {1200UL, 2400UL, 4800UL, 9600UL, 19200UL,
+                                               38400UL, 57600UL, 115200UL};
+static usart_autobaud_state_t eusart_autobaud_state = EUSART_AUTOBAUD_IDLE;
+static uint32 eusart_autobaud_rate = ZERO_INIT;
+static uint16 eusart_autobaud_saved_brg = ZERO_INIT;
+static uint8 eusart_autobaud_saved_brg16 = ZERO_INIT;
+static uint8 eusart_autobaud_saved_rcie = ZERO_INIT;
+
+static void Eusart_AutoBaud_Finish(usart_autobaud_state_t state);
+#endif
+
+#if EUSART_CFG_BUFFERED==EUSART_CFG_FEATURE_ENABLE
+static uint8 eusart_tx_buffer[EUSART_CFG_TX_BUFFER_SIZE];
+static volatile uint8 eusart_rx_buffer[EUSART_CFG_RX_BUFFER_SIZE];
+//Free running indexes, each one is written by a single side only.
+static volatile uint8 eusart_tx_head = ZERO_INIT;   /* Eusart_Write() */
+static volatile uint8 eusart_tx_tail = ZERO_INIT;   /* EUSART_TX_ISR() */
+static volatile uint8 eusart_rx_head = ZERO_INIT;   /* EUSART_RX_ISR() */
+static volatile uint8 eusart_rx_tail = ZERO_INIT;   /* Eusart_Read() */
+static volatile usart_stats_t eusart_stats;
+static void (*eusart_rx_byte_handler)(uint8 data) = NULL;
+#endif
+
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+//9th bit of every TX ring slot, written with the slot by the producer.
+static uint8 eusart_tx_bit9[EUSART_TX_BIT9_BYTES];
+static volatile uint8 eusart_multidrop_active = ZERO_INIT;
+static uint8 eusart_node_address = ZERO_INIT;
+static uint8 eusart_broadcast_address = ZERO_INIT;
+static uint8 eusart_de_pin_enable = ZERO_INIT;
+static pin_config_t eusart_de_pin;
+static uint32 eusart_bit_clocks = ZERO_INIT;    /* Oscillator clocks per bit, Eusart_Brg_Apply() */
+static timer3_t eusart_de_timer;                /* Driver-enable release one-shot */
+static void (*EUSART_AddressHandler)(uint8 address) = NULL;
+
+static inline void Eusart_Tx_Bit9_Write(uint8 index, uint8 bit9);
+static inline void Eusart_Multidrop_Address(uint8 address);
+static Std_ReturnType Eusart_De_Timer_Init(void);
+static void Eusart_De_Timer_Handler(void);
+#endif
+
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+static volatile usart_flow_mode_t eusart_flow_mode = EUSART_FLOW_NONE;
+static pin_config_t eusart_rts_pin;
+static pin_config_t eusart_cts_pin;
+static volatile uint8 eusart_rx_throttled = ZERO_INIT;  /* RTS high or XOFF sent */
+static volatile uint8 eusart_tx_paused = ZERO_INIT;     /* CTS high or XOFF received */
+static volatile uint8 eusart_flow_char = ZERO_INIT;     /* XON/XOFF sent before the TX ring, 0 if none */
+
+static inline uint8 Eusart_Flow_Rx_Filter(uint8 data);
+static inline void Eusart_Flow_Rx_Throttle(void);
+static void Eusart_Flow_Rx_Release(void);
+#endif
+
 /**
  * @brief  Initializes the EUSART module for asynchronous communication.
  * 
@@ -44,13 +107,40 @@ Std_ReturnType Eusart_Async_Init(const usart_t *_usart)
         //Init TX, RX pins as input
         TRISCbits.RC6 = 1; 
         TRISCbits.RC7 = 1; 
+#if EUSART_CFG_BUFFERED==EUSART_CFG_FEATURE_ENABLE
+        //Start with empty rings and cleared statistics
+        eusart_tx_head = ZERO_INIT;
+        eusart_tx_tail = ZERO_INIT;
+        eusart_rx_head = ZERO_INIT;
+        eusart_rx_tail = ZERO_INIT;
+        eusart_stats.rx_overrun_errors = ZERO_INIT;
+        eusart_stats.rx_framing_errors = ZERO_INIT;
+        eusart_stats.rx_dropped = ZERO_INIT;
+#endif
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+        //Eusart_Flow_Init() is called again after a re-init
+        eusart_flow_mode = EUSART_FLOW_NONE;
+        eusart_rx_throttled = ZERO_INIT;
+        eusart_tx_paused = ZERO_INIT;
+        eusart_flow_char = ZERO_INIT;
+        eusart_stats.rx_throttle_events = ZERO_INIT;
+        eusart_stats.rx_throttled_ticks = ZERO_INIT;
+#endif
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+        //Eusart_Multidrop_Init() is called again after a re-init
+        eusart_multidrop_active = ZERO_INIT;
+        RCSTAbits.ADDEN = 0;
+#endif
         //Initialize the SPBRGH:SPBRG registers for the appropriate baud rate
-        Eusart_Baudrate_Calc(_usart);
-        //Inittialize TX, RX
-        Eusart_Async_Tx_Init(_usart);
-        Eusart_Async_Rx_Init(_usart);
-        //Enable the Serial Port
-        RCSTAbits.SPEN = 1;
+        ret = Eusart_Baudrate_Calc(_usart);
+        if(E_OK == ret)
+        {
+            //Inittialize TX, RX
+            Eusart_Async_Tx_Init(_usart);
+            Eusart_Async_Rx_Init(_usart);
+            //Enable the Serial Port
+            RCSTAbits.SPEN = 1;
+        }else{/* Nothing */}
     }
     return ret;
 }
@@ -222,213 +312,1141 @@ Std_ReturnType Eusart_Async_SendByte_NonBlocking(uint8 data)
     return ret;
 }
 
+#if EUSART_CFG_BUFFERED==EUSART_CFG_FEATURE_ENABLE
 /**
- * @brief Calculates and configures the baud rate for EUSART communication.
- * 
-  * This function calculates and configures the appropriate baud rate for EUSART communication
- * based on the provided configuration settings. It supports both asynchronous and synchronous modes,
- * as well as 8-bit and 16-bit baud rate generators, high and low-speed modes.
+ * @brief Queues bytes for transmission and returns immediately.
  * 
- * @param _usart A pointer to the EUSART configuration structure containing baud rate settings.
+ * @param buf The bytes to send.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: All the bytes were queued.
+ *         - E_NOT_OK: Not enough room in the TX ring (nothing queued), or NULL buffer.
  */
-static inline void Eusart_Baudrate_Calc(const usart_t *_usart)
+Std_ReturnType Eusart_Write(const uint8 *buf, uint8 len)
 {
-    float32 baudrate_reg_bits = ZERO_INIT;
+    Std_ReturnType ret = E_OK;
+    uint8 l_head = eusart_tx_head;
+    uint8 l_index = ZERO_INIT;
 
-    if(EUSART_ASYNC_8BITS_HIGH_SPEED_BAUDRATE == _usart->baudrate_generator)
+    if(NULL == buf || len > (uint8)(EUSART_CFG_TX_BUFFER_SIZE - (uint8)(l_head - eusart_tx_tail)))
     {
-        //Asynchronous mode
-        TXSTAbits.SYNC = EUSART_ASYNC_MODE_CFG;
-        //8-bit Baud Rate Generator    
-        BAUDCONbits.BRG16 = EUSART_8BITS_BAUD_RATE_CFG;
-        //High Speed
-        TXSTAbits.BRGH = EUSART_ASYNC_HIGH_SPEED_CFG; 
-
-        baudrate_reg_bits = (_XTAL_FREQ/(float32)(16*_usart->baudrate)) - 1;
+        ret = E_NOT_OK;
     }
-    else if (EUSART_ASYNC_8BITS_LOW_SPEED_BAUDRATE == _usart->baudrate_generator)
+    else
     {
-        //Asynchronous mode
-        TXSTAbits.SYNC = EUSART_ASYNC_MODE_CFG;
-        //8-bit Baud Rate Generator 
-        BAUDCONbits.BRG16 = EUSART_8BITS_BAUD_RATE_CFG;
-        //Low Speed
-        TXSTAbits.BRGH = EUSART_ASYNC_LOW_SPEED_CFG;
-
-        baudrate_reg_bits = (_XTAL_FREQ/(float32)(64*_usart->baudrate)) - 1;
+        for(l_index = 0; l_index < len; l_index++)
+        {
+            eusart_tx_buffer[l_head & EUSART_TX_BUFFER_MASK] = buf[l_index];
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+            Eusart_Tx_Bit9_Write(l_head, 0);
+#endif
+            l_head++;
+        }
+        //Publish the bytes, then let EUSART_TX_ISR() feed TXREG
+        eusart_tx_head = l_head;
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+        if(eusart_de_pin_enable)
+        {
+            //Take the bus before the first start bit
+            gpio_pin_write(&eusart_de_pin, GPIO_HIGH);
+        }else{/* Nothing */}
+#endif
+        EUSART_TX_INTERRUPT_ENABLE();
     }
-    else if (EUSART_ASYNC_16BITS_HIGH_SPEED_BAUDRATE == _usart->baudrate_generator)
-    {
-        //Asynchronous mode
-        TXSTAbits.SYNC = EUSART_ASYNC_MODE_CFG;
-        //16-bit Baud Rate Generator 
-        BAUDCONbits.BRG16 = EUSART_16BITS_BAUD_RATE_CFG;
-        //High Speed
-        TXSTAbits.BRGH = EUSART_ASYNC_HIGH_SPEED_CFG;
+    return ret;
+}
 
-        baudrate_reg_bits = (_XTAL_FREQ/(float32)(4*_usart->baudrate)) - 1;
-    } 
-    else if (EUSART_ASYNC_16BITS_LOW_SPEED_BAUDRATE == _usart->baudrate_generator)
-    {
-        //Asynchronous mode
-        TXSTAbits.SYNC = EUSART_ASYNC_MODE_CFG;
-        //16-bit Baud Rate Generator 
-        BAUDCONbits.BRG16 = EUSART_16BITS_BAUD_RATE_CFG;
-        //Low Speed
-        TXSTAbits.BRGH = EUSART_ASYNC_LOW_SPEED_CFG;
+/**
+ * @brief Queues a null-terminated string for transmission and returns immediately.
+ * 
+ * @param str A string to send.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The string was queued.
+ *         - E_NOT_OK: Not enough room in the TX ring (nothing queued), or NULL string.
+ */
+Std_ReturnType Eusart_Write_String(const uint8 *str)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_len = ZERO_INIT;
 
-        baudrate_reg_bits = (_XTAL_FREQ/(float32)(16*_usart->baudrate)) - 1;
-    }    
-    else if (EUSART_SYNC_8BITS_BAUDRATE == _usart->baudrate_generator)
+    if(NULL == str)
     {
-        //Synchronous mode
-        TXSTAbits.SYNC = EUSART_SYNC_MODE_CFG;
-        //8-bit Baud Rate Generator 
-        BAUDCONbits.BRG16 = EUSART_8BITS_BAUD_RATE_CFG;
-        baudrate_reg_bits = (_XTAL_FREQ/(float32)(4*_usart->baudrate)) - 1;
+        ret = E_NOT_OK;
     }
-    else if (EUSART_SYNC_16BITS_BAUDRATE == _usart->baudrate_generator)
+    else
     {
-        //Synchronous mode
-        TXSTAbits.SYNC = EUSART_SYNC_MODE_CFG;
-        //16-bit Baud Rate Generator 
-        BAUDCONbits.BRG16 = EUSART_16BITS_BAUD_RATE_CFG;
-        baudrate_reg_bits = (_XTAL_FREQ/(float32)(4*_usart->baudrate)) - 1;
+        //Longer strings can't fit the ring anyway
+        while(str[l_len] != '\0' && l_len <= EUSART_CFG_TX_BUFFER_SIZE)
+        {
+            l_len++;
+        }
+        ret = Eusart_Write(str, l_len);
     }
-    SPBRG = (uint8)(baudrate_reg_bits);
-    SPBRGH = (uint8)((uint32)baudrate_reg_bits >> 8);
+    return ret;
 }
 
 /**
- * @brief Helper function to set up an Asynchronous Transmission.
+ * @brief Reads received bytes from the RX ring.
  * 
+ * @param buf A buffer to store the bytes.
+ * @param len Size of the buffer.
+ * @param read_len A pointer to store the number of bytes read (0 when the ring is empty).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
  */
-static inline void Eusart_Async_Tx_Init(const usart_t *_usart)
+Std_ReturnType Eusart_Read(uint8 *buf, uint8 len, uint8 *read_len)
 {
-    //Enable TX
-    TXSTAbits.TXEN = EUSART_TX_ENABLE_CFG;
-    //Configure the Interrupt
-    if(EUSART_ASYNC_INTERRUPT_TX_ENABLE_CFG == _usart->tx_cfg.usart_tx_interrupt_enable)
-    {
-        //Enable Tx interrupt
-        EUSART_TX_INTERRUPT_ENABLE();
-        EUSART_TXInterruptHandler = _usart->EUSART_TXInterruptHandler;
+    Std_ReturnType ret = E_OK;
+    uint8 l_tail = eusart_rx_tail;
+    uint8 l_count = ZERO_INIT;
 
-        //Interrupt priority configurations
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
-        INTERRUPT_PriorityLevelsEnable();
-         if(INTERRUPT_HIGH_PRIORITY == _usart->tx_cfg.priority)
+    if(NULL == buf || NULL == read_len)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        while(l_count < len && l_tail != eusart_rx_head)
         {
-            INTERRUPT_GlobalInterruptHighEnable();
-            EUSART_TX_INT_HIGH_PRIORITY();
+            buf[l_count] = eusart_rx_buffer[l_tail & EUSART_RX_BUFFER_MASK];
+            l_tail++;
+            l_count++;
         }
-        else if(INTERRUPT_LOW_PRIORITY == _usart->tx_cfg.priority)
+        //Release the slots only after they have been copied
+        eusart_rx_tail = l_tail;
+        *read_len = l_count;
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+        if(eusart_rx_throttled && (uint8)(eusart_rx_head - l_tail) <= EUSART_CFG_RX_LOW_WATERMARK)
         {
-            INTERRUPT_GlobalInterruptLowEnable();
-            EUSART_TX_INT_LOW_PRIORITY();
+            Eusart_Flow_Rx_Release();
         }else{/* Nothing */}
-#else 
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
-#endif        
-    }
-    else if(EUSART_ASYNC_INTERRUPT_TX_DISABLE_CFG == _usart->tx_cfg.usart_tx_interrupt_enable)
-    {
-        EUSART_TX_INTERRUPT_DISABLE();
+#endif
     }
-    else{/* Nothing */}
-    //Configure transmitted data size
-    if(EUSART_9BITS_TX_CFG == _usart->tx_cfg.usart_tx_9bits_enable)
+    return ret;
+}
+
+/**
+ * @brief Reports the fill levels of the rings.
+ * 
+ * @param rx_available A pointer to store the number of unread bytes (can be NULL).
+ * @param tx_free A pointer to store the free space of the TX ring (can be NULL).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Buffer_Status(uint8 *rx_available, uint8 *tx_free)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL != rx_available)
     {
-        TXSTAbits.TX9 = EUSART_9BITS_TX_CFG;
-    }
-    else if(EUSART_8BITS_TX_CFG == _usart->tx_cfg.usart_tx_9bits_enable)
+        *rx_available = (uint8)(eusart_rx_head - eusart_rx_tail);
+    }else{/* Nothing */}
+    if(NULL != tx_free)
     {
-        TXSTAbits.TX9 = EUSART_8BITS_TX_CFG;
-    }
-    else{/* Nothing */}
+        *tx_free = (uint8)(EUSART_CFG_TX_BUFFER_SIZE - (uint8)(eusart_tx_head - eusart_tx_tail));
+    }else{/* Nothing */}
+    return ret;
 }
 
 /**
- * @brief Helper function to set up an Asynchronous Reception.
+ * @brief Retrieves the receive statistics.
  * 
+ * @param stats A pointer to store the statistics.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
  */
-static inline void Eusart_Async_Rx_Init(const usart_t *_usart)
+Std_ReturnType Eusart_Get_Stats(usart_stats_t *stats)
 {
-    //Enable RX
-    RCSTAbits.CREN = EUSART_RX_ENABLE_CFG;
-    //Configure the Interrupt
-    if(EUSART_ASYNC_INTERRUPT_RX_ENABLE_CFG == _usart->rx_cfg.usart_rx_interrupt_enable)
+    Std_ReturnType ret = E_OK;
+    uint8 l_rx_int_status = PIE1bits.RCIE;
+
+    if(NULL == stats)
     {
-        //Enable Rx interrupt
-        EUSART_RX_INTERRUPT_ENABLE();
-        EUSART_RXInterruptHandler = _usart->EUSART_RXInterruptHandler;
-        EUSART_FramingErrorHandler = _usart->EUSART_FramingErrorHandler;
-        //Interrupt priority configurations
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
-        INTERRUPT_PriorityLevelsEnable();
-         if(INTERRUPT_HIGH_PRIORITY == _usart->tx_cfg.priority)
-        {
-            INTERRUPT_GlobalInterruptHighEnable();
-            EUSART_RX_INT_HIGH_PRIORITY();
-        }
-        else if(INTERRUPT_LOW_PRIORITY == _usart->tx_cfg.priority)
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //The counters are updated by EUSART_RX_ISR(), copy them atomically
+        EUSART_RX_INTERRUPT_DISABLE();
+        stats->rx_overrun_errors = eusart_stats.rx_overrun_errors;
+        stats->rx_framing_errors = eusart_stats.rx_framing_errors;
+        stats->rx_dropped = eusart_stats.rx_dropped;
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+        stats->rx_throttle_events = eusart_stats.rx_throttle_events;
+        //Eusart_Flow_Tick() may run in any interrupt, read until two copies match
+        do
         {
-            INTERRUPT_GlobalInterruptLowEnable();
-            EUSART_RX_INT_LOW_PRIORITY();
-        }else{/* Nothing */}
-#else 
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
+            stats->rx_throttled_ticks = eusart_stats.rx_throttled_ticks;
+        }while(stats->rx_throttled_ticks != eusart_stats.rx_throttled_ticks);
 #endif
+        PIE1bits.RCIE = l_rx_int_status;
     }
-    else if(EUSART_ASYNC_INTERRUPT_RX_DISABLE_CFG == _usart->rx_cfg.usart_rx_interrupt_enable)
+    return ret;
+}
+
+/**
+ * @brief Routes every received byte to a handler instead of the RX ring.
+ * 
+ * @param handler The byte handler, NULL routes the bytes back to the RX ring.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Set_Rx_Byte_Handler(void (*handler)(uint8 data))
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_rx_int_status = PIE1bits.RCIE;
+
+    EUSART_RX_INTERRUPT_DISABLE();
+    eusart_rx_byte_handler = handler;
+    PIE1bits.RCIE = l_rx_int_status;
+    return ret;
+}
+#endif
+
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief Switches the initialized EUSART to 9-bit multidrop mode.
+ * 
+ * @param _multidrop A pointer to the Multidrop Configurations Structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Multidrop_Init(const usart_multidrop_t *_multidrop)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_rx_int_status = PIE1bits.RCIE;
+
+    if(NULL == _multidrop)
     {
-        EUSART_RX_INTERRUPT_DISABLE();
+        ret = E_NOT_OK;
     }
-    else{/* Nothing */}
-    //Configure the received data size
-    if(EUSART_9BITS_RX_CFG == _usart->rx_cfg.usart_rx_9bits_enable)
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+    else if(EUSART_FLOW_NONE != eusart_flow_mode)
     {
-        RCSTAbits.RX9 = EUSART_9BITS_RX_CFG;
+        ret = E_NOT_OK;
     }
-    else if(EUSART_8BITS_TX_CFG == _usart->rx_cfg.usart_rx_9bits_enable)
+#endif
+    else
     {
-        RCSTAbits.RX9 = EUSART_8BITS_RX_CFG;
+        EUSART_RX_INTERRUPT_DISABLE();
+        eusart_node_address = _multidrop->node_address;
+        eusart_broadcast_address = _multidrop->broadcast_address;
+        EUSART_AddressHandler = _multidrop->EUSART_AddressHandler;
+        eusart_de_pin_enable = _multidrop->de_pin_enable;
+        if(eusart_de_pin_enable)
+        {
+            //Receive until something is queued
+            eusart_de_pin = _multidrop->de_pin;
+            eusart_de_pin.direction = GPIO_DIRECTION_OUTPUT;
+            eusart_de_pin.logic = GPIO_LOW;
+            ret = gpio_pin_initialize(&eusart_de_pin);
+            if(E_OK == ret)
+            {
+                ret = Eusart_De_Timer_Init();
+            }else{/* Nothing */}
+        }else{/* Nothing */}
+        //9-bit frames both ways, wait for an address byte
+        TXSTAbits.TX9 = EUSART_9BITS_TX_CFG;
+        RCSTAbits.RX9 = EUSART_9BITS_RX_CFG;
+        RCSTAbits.ADDEN = 1;
+        eusart_multidrop_active = 1;
+        PIE1bits.RCIE = l_rx_int_status;
     }
-    else{/* Nothing */}
+    return ret;
 }
 
 /**
- * @brief Helper function to restart the receiver when there is an error.
+ * @brief Leaves multidrop mode, every byte is received again (9-bit mode is kept).
  * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
  */
-static inline void Eusart_Async_Rx_Restart(void)
-{ 
-    RCSTAbits.CREN = 0;             //If error -> Reset
-    RCSTAbits.CREN = 1;             //If error -> Reset 
+Std_ReturnType Eusart_Multidrop_DeInit(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_rx_int_status = PIE1bits.RCIE;
+
+    EUSART_RX_INTERRUPT_DISABLE();
+    eusart_multidrop_active = ZERO_INIT;
+    RCSTAbits.ADDEN = 0;
+    PIE1bits.RCIE = l_rx_int_status;
+    return ret;
 }
 
 /**
- * @brief The EUSART_TX interrupt MCAL helper function
+ * @brief Deselects the node once its message is complete, only address bytes interrupt.
  * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Multidrop mode isn't active.
  */
-void EUSART_TX_ISR(void)
+Std_ReturnType Eusart_Multidrop_Listen(void)
 {
-    EUSART_TX_INTERRUPT_DISABLE();
-    //CallBack func gets called every time this ISR executes.
-    if(EUSART_TXInterruptHandler)
+    Std_ReturnType ret = E_OK;
+
+    if(ZERO_INIT == eusart_multidrop_active)
     {
-        EUSART_TXInterruptHandler();
-    }else{/* Nothing */}
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        RCSTAbits.ADDEN = 1;
+    }
+    return ret;
 }
 
 /**
- * @brief The EUSART_RX interrupt MCAL helper function
+ * @brief Queues an address byte (9th bit set) followed by data bytes.
+ * 
+ * @param address The destination node address.
+ * @param buf The data bytes (can be NULL when len is 0).
+ * @param len Number of data bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The message was queued.
+ *         - E_NOT_OK: Multidrop mode isn't active, or not enough room in the TX ring.
+ */
+Std_ReturnType Eusart_Multidrop_Send(uint8 address, const uint8 *buf, uint8 len)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_head = eusart_tx_head;
+    uint8 l_index = ZERO_INIT;
+
+    if(ZERO_INIT == eusart_multidrop_active || (NULL == buf && ZERO_INIT != len) ||
+       ((uint16)len + 1U) > (uint16)(EUSART_CFG_TX_BUFFER_SIZE - (uint8)(l_head - eusart_tx_tail)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        eusart_tx_buffer[l_head & EUSART_TX_BUFFER_MASK] = address;
+        Eusart_Tx_Bit9_Write(l_head, 1);
+        l_head++;
+        for(l_index = 0; l_index < len; l_index++)
+        {
+            eusart_tx_buffer[l_head & EUSART_TX_BUFFER_MASK] = buf[l_index];
+            Eusart_Tx_Bit9_Write(l_head, 0);
+            l_head++;
+        }
+        //Publish the message, then let EUSART_TX_ISR() feed TXREG
+        eusart_tx_head = l_head;
+        if(eusart_de_pin_enable)
+        {
+            gpio_pin_write(&eusart_de_pin, GPIO_HIGH);
+        }else{/* Nothing */}
+        EUSART_TX_INTERRUPT_ENABLE();
+    }
+    return ret;
+}
+#endif
+
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief Starts flow control on the initialized EUSART.
+ * 
+ * @param _flow A pointer to the Flow Control Configurations Structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid mode, or multidrop mode is active.
+ */
+Std_ReturnType Eusart_Flow_Init(const usart_flow_t *_flow)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_rx_int_status = PIE1bits.RCIE;
+
+    if(NULL == _flow || _flow->mode > EUSART_FLOW_XON_XOFF)
+    {
+        ret = E_NOT_OK;
+    }
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+    else if(eusart_multidrop_active)
+    {
+        ret = E_NOT_OK;
+    }
+#endif
+    else
+    {
+        ret = Eusart_Flow_DeInit();
+        EUSART_RX_INTERRUPT_DISABLE();
+        if(EUSART_FLOW_RTS_CTS == _flow->mode)
+        {
+            //Ready to receive
+            eusart_rts_pin = _flow->rts_pin;
+            eusart_rts_pin.direction = GPIO_DIRECTION_OUTPUT;
+            eusart_rts_pin.logic = GPIO_LOW;
+            ret &= gpio_pin_initialize(&eusart_rts_pin);
+            eusart_cts_pin = _flow->cts_pin;
+            eusart_cts_pin.direction = GPIO_DIRECTION_INPUT;
+            ret &= gpio_pin_set_direction(&eusart_cts_pin);
+        }else{/* Nothing */}
+        eusart_flow_mode = _flow->mode;
+        //Bytes already waiting may be above the watermark
+        if(EUSART_FLOW_NONE != eusart_flow_mode &&
+           (uint8)(eusart_rx_head - eusart_rx_tail) >= EUSART_CFG_RX_HIGH_WATERMARK)
+        {
+            Eusart_Flow_Rx_Throttle();
+        }else{/* Nothing */}
+        PIE1bits.RCIE = l_rx_int_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief Stops flow control, RTS is left low and a paused transmitter resumes.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Flow_DeInit(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_rx_int_status = PIE1bits.RCIE;
+
+    EUSART_RX_INTERRUPT_DISABLE();
+    if(EUSART_FLOW_RTS_CTS == eusart_flow_mode)
+    {
+        ret = gpio_pin_write(&eusart_rts_pin, GPIO_LOW);
+    }else{/* Nothing */}
+    eusart_flow_mode = EUSART_FLOW_NONE;
+    eusart_rx_throttled = ZERO_INIT;
+    eusart_flow_char = ZERO_INIT;
+    eusart_tx_paused = ZERO_INIT;
+    PIE1bits.RCIE = l_rx_int_status;
+    //EUSART_TX_ISR() disables itself again when the ring is empty
+    EUSART_TX_INTERRUPT_ENABLE();
+    return ret;
+}
+
+/**
+ * @brief Flow control time base, call it periodically (a timer ISR or the main loop).
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Flow_Tick(void)
+{
+    Std_ReturnType ret = E_OK;
+    logic_t l_cts = GPIO_LOW;
+
+    if(eusart_rx_throttled)
+    {
+        eusart_stats.rx_throttled_ticks++;
+    }else{/* Nothing */}
+    if(eusart_tx_paused && EUSART_FLOW_RTS_CTS == eusart_flow_mode)
+    {
+        ret = gpio_pin_read(&eusart_cts_pin, &l_cts);
+        if(GPIO_LOW == l_cts)
+        {
+            eusart_tx_paused = ZERO_INIT;
+            EUSART_TX_INTERRUPT_ENABLE();
+        }else{/* Nothing */}
+    }else{/* Nothing */}
+    return ret;
+}
+#endif
+
+/**
+ * @brief Reports the baud rate set by Eusart_Async_Init().
+ * 
+ * @param achieved_baud A pointer to store the achieved baud rate in bit/s (can be NULL).
+ * @param error_ppm A pointer to store the error in ppm (can be NULL).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Get_Baudrate(uint32 *achieved_baud, sint32 *error_ppm)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL != achieved_baud)
+    {
+        *achieved_baud = eusart_achieved_baud;
+    }else{/* Nothing */}
+    if(NULL != error_ppm)
+    {
+        *error_ppm = eusart_baud_error_ppm;
+    }else{/* Nothing */}
+    return ret;
+}
+
+#if EUSART_CFG_AUTOBAUD==EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief Starts auto-baud detection, the host must then send 0x55 ('U').
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The detection is running.
+ *         - E_NOT_OK: The EUSART isn't in asynchronous mode or a detection is running.
+ */
+Std_ReturnType Eusart_AutoBaud_Start(void)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(TXSTAbits.SYNC || EUSART_AUTOBAUD_RUNNING == eusart_autobaud_state)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //Keep the current rate to restore it on failure
+        eusart_autobaud_saved_brg = (uint16)(((uint16)SPBRGH << 8) | SPBRG);
+        eusart_autobaud_saved_brg16 = BAUDCONbits.BRG16;
+        eusart_autobaud_saved_rcie = PIE1bits.RCIE;
+        //The sync character completes with RCIF set, keep it away from EUSART_RX_ISR()
+        EUSART_RX_INTERRUPT_DISABLE();
+        BAUDCONbits.ABDOVF = 0;
+        eusart_autobaud_state = EUSART_AUTOBAUD_RUNNING;
+        BAUDCONbits.ABDEN = 1;
+    }
+    return ret;
+}
+
+/**
+ * @brief Advances the auto-baud detection, call it from the main loop.
+ * 
+ * @param state A pointer to store the detection state.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_AutoBaud_Poll(usart_autobaud_state_t *state)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_clocks = ZERO_INIT;
+    uint32 l_measured = ZERO_INIT;
+    uint32 l_delta = ZERO_INIT;
+    uint16 l_brg = ZERO_INIT;
+    sint32 l_error = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+
+    if(NULL == state)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(EUSART_AUTOBAUD_RUNNING == eusart_autobaud_state)
+        {
+            if(BAUDCONbits.ABDOVF)
+            {
+                //The 16-bit counter rolled over: the host is slower than the generator can measure
+                BAUDCONbits.ABDEN = 0;
+                BAUDCONbits.ABDOVF = 0;
+                Eusart_AutoBaud_Finish(EUSART_AUTOBAUD_FAILED);
+            }
+            else if(0 == BAUDCONbits.ABDEN)
+            {
+                //Detection complete, the received byte is meaningless
+                (void)RCREG;
+                l_brg = (uint16)(((uint16)SPBRGH << 8) | SPBRG);
+                l_clocks = (uint32)Eusart_Async_Divisor() * (l_brg + 1UL);
+                l_measured = ((uint32)_XTAL_FREQ + (l_clocks / 2)) / l_clocks;
+                eusart_autobaud_state = EUSART_AUTOBAUD_FAILED;
+                for(l_index = 0; l_index < (sizeof(eusart_standard_rates) / sizeof(eusart_standard_rates[0])); l_index++)
+                {
+                    l_delta = (l_measured > eusart_standard_rates[l_index]) ?
+                              (l_measured - eusart_standard_rates[l_index]) :
+                              (eusart_standard_rates[l_index] - l_measured);
+                    //delta / rate <= tolerance, in per mille to stay within 32 bits
+                    if((l_delta * 1000UL) <= eusart_standard_rates[l_index] * (EUSART_CFG_AUTOBAUD_TOLERANCE_PPM / 1000UL))
+                    {
+                        eusart_autobaud_state = EUSART_AUTOBAUD_LOCKED;
+                        break;
+                    }else{/* Nothing */}
+                }
+                //The count is 16 bits even with the 8-bit generator, which can only hold up to 255
+                if(EUSART_AUTOBAUD_LOCKED == eusart_autobaud_state && 0 == BAUDCONbits.BRG16 &&
+                   E_OK != Eusart_Brg_Compute(eusart_standard_rates[l_index], Eusart_Async_Divisor(),
+                                              BAUDCONbits.BRG16, &l_brg, &l_error))
+                {
+                    BAUDCONbits.BRG16 = 1;
+                }else{/* Nothing */}
+                if(EUSART_AUTOBAUD_LOCKED == eusart_autobaud_state &&
+                   E_OK == Eusart_Brg_Compute(eusart_standard_rates[l_index], Eusart_Async_Divisor(),
+                                              BAUDCONbits.BRG16, &l_brg, &l_error))
+                {
+                    //Use the exact divisor of the standard rate, not the measured one
+                    eusart_autobaud_rate = eusart_standard_rates[l_index];
+                    Eusart_Brg_Apply(l_brg, l_error);
+                    Eusart_AutoBaud_Finish(EUSART_AUTOBAUD_LOCKED);
+                }
+                else
+                {
+                    Eusart_AutoBaud_Finish(EUSART_AUTOBAUD_FAILED);
+                }
+            }else{/* Nothing */}
+        }else{/* Nothing */}
+        *state = eusart_autobaud_state;
+    }
+    return ret;
+}
+
+/**
+ * @brief Retrieves the standard rate locked by the last successful detection.
+ * 
+ * @param baudrate A pointer to store the rate in bit/s.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: No rate detected yet, or NULL pointer.
+ */
+Std_ReturnType Eusart_AutoBaud_Get_Rate(uint32 *baudrate)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == baudrate || ZERO_INIT == eusart_autobaud_rate)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *baudrate = eusart_autobaud_rate;
+    }
+    return ret;
+}
+
+/**
+ * @brief Ends a detection, restores the previous rate on failure and the RX interrupt.
+ * 
+ */
+static void Eusart_AutoBaud_Finish(usart_autobaud_state_t state)
+{
+    if(EUSART_AUTOBAUD_FAILED == state)
+    {
+        BAUDCONbits.BRG16 = eusart_autobaud_saved_brg16;
+        SPBRG = (uint8)(eusart_autobaud_saved_brg);
+        SPBRGH = (uint8)(eusart_autobaud_saved_brg >> 8);
+    }else{/* Nothing */}
+    //Drop anything received while measuring and clear an overrun
+    if(RCSTAbits.OERR)
+    {
+        Eusart_Async_Rx_Restart();
+    }else{/* Nothing */}
+    eusart_autobaud_state = state;
+    PIE1bits.RCIE = eusart_autobaud_saved_rcie;
+}
+#endif
+
+/**
+ * @brief Calculates and configures the baud rate for EUSART communication.
+ * 
+ * This function calculates and configures the appropriate baud rate for EUSART communication
+ * based on the provided configuration settings. It supports both asynchronous and synchronous modes,
+ * as well as 8-bit and 16-bit baud rate generators, high and low-speed modes.
+ * The divisor is rounded with integer math, EUSART_ASYNC_AUTO_BAUDRATE picks the
+ * asynchronous mode with the lowest error.
+ * 
+ * @param _usart A pointer to the EUSART configuration structure containing baud rate settings.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: The baud rate is out of range for the selected mode.
+ */
+static Std_ReturnType Eusart_Baudrate_Calc(const usart_t *_usart)
+{
+    Std_ReturnType ret = E_OK;
+    usart_baudrate_gen_t l_mode = _usart->baudrate_generator;
+    uint8 l_divisor = ZERO_INIT;
+    uint16 l_brg = ZERO_INIT;
+    sint32 l_error = ZERO_INIT;
+
+    if(EUSART_ASYNC_AUTO_BAUDRATE == l_mode)
+    {
+        l_mode = Eusart_Best_Async_Mode(_usart->baudrate);
+    }else{/* Nothing */}
+
+    if(EUSART_ASYNC_8BITS_HIGH_SPEED_BAUDRATE == l_mode)
+    {
+        //Asynchronous mode
+        TXSTAbits.SYNC = EUSART_ASYNC_MODE_CFG;
+        //8-bit Baud Rate Generator    
+        BAUDCONbits.BRG16 = EUSART_8BITS_BAUD_RATE_CFG;
+        //High Speed
+        TXSTAbits.BRGH = EUSART_ASYNC_HIGH_SPEED_CFG; 
+        l_divisor = 16;
+    }
+    else if (EUSART_ASYNC_8BITS_LOW_SPEED_BAUDRATE == l_mode)
+    {
+        //Asynchronous mode
+        TXSTAbits.SYNC = EUSART_ASYNC_MODE_CFG;
+        //8-bit Baud Rate Generator 
+        BAUDCONbits.BRG16 = EUSART_8BITS_BAUD_RATE_CFG;
+        //Low Speed
+        TXSTAbits.BRGH = EUSART_ASYNC_LOW_SPEED_CFG;
+        l_divisor = 64;
+    }
+    else if (EUSART_ASYNC_16BITS_HIGH_SPEED_BAUDRATE == l_mode)
+    {
+        //Asynchronous mode
+        TXSTAbits.SYNC = EUSART_ASYNC_MODE_CFG;
+        //16-bit Baud Rate Generator 
+        BAUDCONbits.BRG16 = EUSART_16BITS_BAUD_RATE_CFG;
+        //High Speed
+        TXSTAbits.BRGH = EUSART_ASYNC_HIGH_SPEED_CFG;
+        l_divisor = 4;
+    } 
+    else if (EUSART_ASYNC_16BITS_LOW_SPEED_BAUDRATE == l_mode)
+    {
+        //Asynchronous mode
+        TXSTAbits.SYNC = EUSART_ASYNC_MODE_CFG;
+        //16-bit Baud Rate Generator 
+        BAUDCONbits.BRG16 = EUSART_16BITS_BAUD_RATE_CFG;
+        //Low Speed
+        TXSTAbits.BRGH = EUSART_ASYNC_LOW_SPEED_CFG;
+        l_divisor = 16;
+    }    
+    else if (EUSART_SYNC_8BITS_BAUDRATE == l_mode)
+    {
+        //Synchronous mode
+        TXSTAbits.SYNC = EUSART_SYNC_MODE_CFG;
+        //8-bit Baud Rate Generator 
+        BAUDCONbits.BRG16 = EUSART_8BITS_BAUD_RATE_CFG;
+        l_divisor = 4;
+    }
+    else if (EUSART_SYNC_16BITS_BAUDRATE == l_mode)
+    {
+        //Synchronous mode
+        TXSTAbits.SYNC = EUSART_SYNC_MODE_CFG;
+        //16-bit Baud Rate Generator 
+        BAUDCONbits.BRG16 = EUSART_16BITS_BAUD_RATE_CFG;
+        l_divisor = 4;
+    }
+    else
+    {
+        ret = E_NOT_OK;
+    }
+
+    if(E_OK == ret)
+    {
+        ret = Eusart_Brg_Compute(_usart->baudrate, l_divisor, BAUDCONbits.BRG16, &l_brg, &l_error);
+    }else{/* Nothing */}
+    if(E_OK == ret)
+    {
+        Eusart_Brg_Apply(l_brg, l_error);
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief Returns the clocks per bit of the current asynchronous generator mode.
+ * 
+ */
+static uint8 Eusart_Async_Divisor(void)
+{
+    uint8 l_divisor = 64;
+
+    if(BAUDCONbits.BRG16 && TXSTAbits.BRGH)
+    {
+        l_divisor = 4;
+    }
+    else if(BAUDCONbits.BRG16 || TXSTAbits.BRGH)
+    {
+        l_divisor = 16;
+    }else{/* Nothing */}
+    return l_divisor;
+}
+
+/**
+ * @brief Writes SPBRGH:SPBRG and records the achieved rate.
+ * 
+ */
+static void Eusart_Brg_Apply(uint16 brg, sint32 error_ppm)
+{
+    uint32 l_clocks = ZERO_INIT;
+
+    //The synchronous modes divide by 4 like the 16-bit high speed mode
+    l_clocks = (uint32)(TXSTAbits.SYNC ? 4U : Eusart_Async_Divisor()) * (brg + 1UL);
+    SPBRG = (uint8)(brg);
+    SPBRGH = (uint8)(brg >> 8);
+    eusart_achieved_baud = ((uint32)_XTAL_FREQ + (l_clocks / 2)) / l_clocks;
+    eusart_baud_error_ppm = error_ppm;
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+    eusart_bit_clocks = l_clocks;
+    if(eusart_de_pin_enable)
+    {
+        //The one-shot follows the new rate
+        (void)Eusart_De_Timer_Init();
+    }else{/* Nothing */}
+#endif
+}
+
+/**
+ * @brief Computes the rounded SPBRGH:SPBRG value and its error for one generator mode.
+ * 
+ * The error is (Fosc - baud * divisor * (BRG + 1)) / (baud * divisor * (BRG + 1)) in ppm.
+ * Both terms are scaled below 2^22 first, so the two decimal steps of the division
+ * stay within 32 bits.
+ * 
+ * @param baudrate The requested baud rate.
+ * @param divisor Clocks per bit: 64, 16 or 4.
+ * @param brg16 1 for the 16-bit generator, 0 for the 8-bit one.
+ * @param brg A pointer to store the register value.
+ * @param error_ppm A pointer to store the error in ppm.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: The value doesn't fit the generator.
+ */
+static Std_ReturnType Eusart_Brg_Compute(uint32 baudrate, uint8 divisor, uint8 brg16,
+                                         uint16 *brg, sint32 *error_ppm)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_clocks_per_count = ZERO_INIT;
+    uint32 l_counts = ZERO_INIT;
+    uint32 l_den = ZERO_INIT;
+    uint32 l_diff = ZERO_INIT;
+    uint32 l_ppm = ZERO_INIT;
+    uint8 l_negative = 0;
+
+    if(ZERO_INIT == baudrate || ZERO_INIT == divisor)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_clocks_per_count = (uint32)divisor * baudrate;
+        //Rounded Fosc / (divisor * baud) = BRG + 1
+        l_counts = ((uint32)_XTAL_FREQ + (l_clocks_per_count / 2)) / l_clocks_per_count;
+        if(ZERO_INIT == l_counts || l_counts > (brg16 ? 65536UL : 256UL))
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            *brg = (uint16)(l_counts - 1);
+            l_den = l_counts * l_clocks_per_count;
+            if((uint32)_XTAL_FREQ >= l_den)
+            {
+                l_diff = (uint32)_XTAL_FREQ - l_den;
+            }
+            else
+            {
+                l_diff = l_den - (uint32)_XTAL_FREQ;
+                l_negative = 1;
+            }
+            //Rounding keeps l_diff <= l_den / 2, scale both below 2^22
+            while(l_den >= 0x400000UL)
+            {
+                l_den >>= 1;
+                l_diff >>= 1;
+            }
+            //ppm = diff * 10^6 / den, in two steps of 10^3
+            l_ppm = ((l_diff * 1000UL) / l_den) * 1000UL;
+            l_ppm += (((l_diff * 1000UL) % l_den) * 1000UL) / l_den;
+            *error_ppm = l_negative ? -(sint32)l_ppm : (sint32)l_ppm;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Picks the asynchronous generator mode with the lowest baud rate error.
+ * 
+ * @param baudrate The requested baud rate.
+ * @return usart_baudrate_gen_t The best mode, the 16-bit high speed mode wins ties.
+ */
+static usart_baudrate_gen_t Eusart_Best_Async_Mode(uint32 baudrate)
+{
+    static const usart_baudrate_gen_t l_modes[4] = {
+        EUSART_ASYNC_16BITS_HIGH_SPEED_BAUDRATE, EUSART_ASYNC_16BITS_LOW_SPEED_BAUDRATE,
+        EUSART_ASYNC_8BITS_HIGH_SPEED_BAUDRATE, EUSART_ASYNC_8BITS_LOW_SPEED_BAUDRATE
+    };
+    static const uint8 l_divisors[4] = {4, 16, 16, 64};
+    static const uint8 l_brg16[4] = {1, 1, 0, 0};
+    usart_baudrate_gen_t l_best = EUSART_ASYNC_16BITS_HIGH_SPEED_BAUDRATE;
+    uint32 l_best_error = 0xFFFFFFFFUL;
+    uint16 l_brg = ZERO_INIT;
+    sint32 l_error = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+
+    for(l_index = 0; l_index < 4; l_index++)
+    {
+        if(E_OK == Eusart_Brg_Compute(baudrate, l_divisors[l_index], l_brg16[l_index], &l_brg, &l_error))
+        {
+            if((uint32)EUSART_BAUD_ABS(l_error) < l_best_error)
+            {
+                l_best_error = (uint32)EUSART_BAUD_ABS(l_error);
+                l_best = l_modes[l_index];
+            }else{/* Nothing */}
+        }else{/* Nothing */}
+    }
+    return l_best;
+}
+
+/**
+ * @brief Helper function to set up an Asynchronous Transmission.
+ * 
+ */
+static inline void Eusart_Async_Tx_Init(const usart_t *_usart)
+{
+    //Enable TX
+    TXSTAbits.TXEN = EUSART_TX_ENABLE_CFG;
+    //Configure the Interrupt
+    if(EUSART_ASYNC_INTERRUPT_TX_ENABLE_CFG == _usart->tx_cfg.usart_tx_interrupt_enable)
+    {
+        //Enable Tx interrupt
+        EUSART_TX_INTERRUPT_ENABLE();
+        EUSART_TXInterruptHandler = _usart->EUSART_TXInterruptHandler;
+
+        //Interrupt priority configurations
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+        INTERRUPT_PriorityLevelsEnable();
+         if(INTERRUPT_HIGH_PRIORITY == _usart->tx_cfg.priority)
+        {
+            INTERRUPT_GlobalInterruptHighEnable();
+            EUSART_TX_INT_HIGH_PRIORITY();
+        }
+        else if(INTERRUPT_LOW_PRIORITY == _usart->tx_cfg.priority)
+        {
+            INTERRUPT_GlobalInterruptLowEnable();
+            EUSART_TX_INT_LOW_PRIORITY();
+        }else{/* Nothing */}
+#else 
+        INTERRUPT_GlobalInterruptEnable();
+        INTERRUPT_PeripheralInterruptEnable();
+#endif        
+    }
+    else if(EUSART_ASYNC_INTERRUPT_TX_DISABLE_CFG == _usart->tx_cfg.usart_tx_interrupt_enable)
+    {
+        EUSART_TX_INTERRUPT_DISABLE();
+    }
+    else{/* Nothing */}
+    //Configure transmitted data size
+    if(EUSART_9BITS_TX_CFG == _usart->tx_cfg.usart_tx_9bits_enable)
+    {
+        TXSTAbits.TX9 = EUSART_9BITS_TX_CFG;
+    }
+    else if(EUSART_8BITS_TX_CFG == _usart->tx_cfg.usart_tx_9bits_enable)
+    {
+        TXSTAbits.TX9 = EUSART_8BITS_TX_CFG;
+    }
+    else{/* Nothing */}
+}
+
+/**
+ * @brief Helper function to set up an Asynchronous Reception.
+ * 
+ */
+static inline void Eusart_Async_Rx_Init(const usart_t *_usart)
+{
+    //Enable RX
+    RCSTAbits.CREN = EUSART_RX_ENABLE_CFG;
+    //Configure the Interrupt
+    if(EUSART_ASYNC_INTERRUPT_RX_ENABLE_CFG == _usart->rx_cfg.usart_rx_interrupt_enable)
+    {
+        //Enable Rx interrupt
+        EUSART_RX_INTERRUPT_ENABLE();
+        EUSART_RXInterruptHandler = _usart->EUSART_RXInterruptHandler;
+        EUSART_FramingErrorHandler = _usart->EUSART_FramingErrorHandler;
+        //Interrupt priority configurations
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+        INTERRUPT_PriorityLevelsEnable();
+         if(INTERRUPT_HIGH_PRIORITY == _usart->tx_cfg.priority)
+        {
+            INTERRUPT_GlobalInterruptHighEnable();
+            EUSART_RX_INT_HIGH_PRIORITY();
+        }
+        else if(INTERRUPT_LOW_PRIORITY == _usart->tx_cfg.priority)
+        {
+            INTERRUPT_GlobalInterruptLowEnable();
+            EUSART_RX_INT_LOW_PRIORITY();
+        }else{/* Nothing */}
+#else 
+        INTERRUPT_GlobalInterruptEnable();
+        INTERRUPT_PeripheralInterruptEnable();
+#endif
+    }
+    else if(EUSART_ASYNC_INTERRUPT_RX_DISABLE_CFG == _usart->rx_cfg.usart_rx_interrupt_enable)
+    {
+        EUSART_RX_INTERRUPT_DISABLE();
+    }
+    else{/* Nothing */}
+    //Configure the received data size
+    if(EUSART_9BITS_RX_CFG == _usart->rx_cfg.usart_rx_9bits_enable)
+    {
+        RCSTAbits.RX9 = EUSART_9BITS_RX_CFG;
+    }
+    else if(EUSART_8BITS_TX_CFG == _usart->rx_cfg.usart_rx_9bits_enable)
+    {
+        RCSTAbits.RX9 = EUSART_8BITS_RX_CFG;
+    }
+    else{/* Nothing */}
+}
+
+/**
+ * @brief Helper function to restart the receiver when there is an error.
+ * 
+ */
+static inline void Eusart_Async_Rx_Restart(void)
+{ 
+    RCSTAbits.CREN = 0;             //If error -> Reset
+    RCSTAbits.CREN = 1;             //If error -> Reset 
+}
+
+/**
+ * @brief The EUSART_TX interrupt MCAL helper function
+ * 
+ */
+void EUSART_TX_ISR(void)
+{
+#if EUSART_CFG_BUFFERED==EUSART_CFG_FEATURE_ENABLE
+    uint8 l_tail = eusart_tx_tail;
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+    uint8 l_slot = ZERO_INIT;
+#endif
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+    uint8 l_flow_char = eusart_flow_char;
+    logic_t l_cts = GPIO_LOW;
+
+    if(EUSART_FLOW_RTS_CTS == eusart_flow_mode)
+    {
+        gpio_pin_read(&eusart_cts_pin, &l_cts);
+        eusart_tx_paused = (uint8)l_cts;
+    }else{/* Nothing */}
+    if(l_flow_char)
+    {
+        //XON/XOFF goes out ahead of the queued bytes, even while paused
+        TXREG = l_flow_char;
+        if(l_flow_char == eusart_flow_char)
+        {
+            eusart_flow_char = ZERO_INIT;
+        }else{/* Nothing */}
+    }
+    else if(eusart_tx_paused)
+    {
+        //The peer can't take more, Eusart_Flow_Tick() or XON resumes
+        EUSART_TX_INTERRUPT_DISABLE();
+    }
+    else
+#endif
+    if(l_tail != eusart_tx_head)
+    {
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+        //The 9th bit must be in place before TXREG is loaded
+        l_slot = l_tail & EUSART_TX_BUFFER_MASK;
+        TXSTAbits.TX9D = (eusart_tx_bit9[l_slot >> 3] >> (l_slot & 0x07U)) & 0x01U;
+#endif
+        //TXREG is empty, move the next byte
+        TXREG = eusart_tx_buffer[l_tail & EUSART_TX_BUFFER_MASK];
+        eusart_tx_tail = (uint8)(l_tail + 1);
+    }
+    else
+    {
+        //Ring drained, Eusart_Write() enables the interrupt again
+        EUSART_TX_INTERRUPT_DISABLE();
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+        if(eusart_de_pin_enable)
+        {
+            //The last byte just moved to the shift register, the one-shot releases the bus
+            //after its stop bit
+            Timer3_Write_Value(&eusart_de_timer, eusart_de_timer.timer3_preload);
+            TIMER3_INTERRUPT_FLAG_CLEAR();
+            TIMER3_MODULE_ENABLE();
+        }else{/* Nothing */}
+#endif
+        //CallBack func gets called when the last queued byte was handed to the transmitter.
+        if(EUSART_TXInterruptHandler)
+        {
+            EUSART_TXInterruptHandler();
+        }else{/* Nothing */}
+    }
+#else
+    EUSART_TX_INTERRUPT_DISABLE();
+    //CallBack func gets called every time this ISR executes.
+    if(EUSART_TXInterruptHandler)
+    {
+        EUSART_TXInterruptHandler();
+    }else{/* Nothing */}
+#endif
+}
+
+/**
+ * @brief The EUSART_RX interrupt MCAL helper function
  * 
  */
 void EUSART_RX_ISR(void)
 {
+#if EUSART_CFG_BUFFERED==EUSART_CFG_FEATURE_ENABLE
+    uint8 l_head = eusart_rx_head;
+    uint8 l_data = ZERO_INIT;
+    uint8 l_framing_error = 0;
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+    uint8 l_address = ZERO_INIT;
+#endif
+
+    //Drain the 2-byte FIFO, FERR belongs to the byte on top and must be read before RCREG
+    while(PIR1bits.RCIF)
+    {
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+        //So does RX9D
+        l_address = (uint8)(eusart_multidrop_active && RCSTAbits.RX9D);
+#endif
+        if(RCSTAbits.FERR)
+        {
+            l_data = RCREG;
+            eusart_stats.rx_framing_errors++;
+            l_framing_error = 1;
+        }
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+        else if(l_address)
+        {
+            l_data = RCREG;
+            Eusart_Multidrop_Address(l_data);
+        }
+#endif
+        else
+        {
+            l_data = RCREG;
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+            if(Eusart_Flow_Rx_Filter(l_data))
+            {
+                /* XON or XOFF from the peer */
+            }
+            else
+#endif
+            if(eusart_rx_byte_handler)
+            {
+                eusart_rx_byte_handler(l_data);
+            }
+            else if((uint8)(l_head - eusart_rx_tail) >= EUSART_CFG_RX_BUFFER_SIZE)
+            {
+                eusart_stats.rx_dropped++;
+            }
+            else
+            {
+                eusart_rx_buffer[l_head & EUSART_RX_BUFFER_MASK] = l_data;
+                l_head++;
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+                if((uint8)(l_head - eusart_rx_tail) >= EUSART_CFG_RX_HIGH_WATERMARK &&
+                   EUSART_FLOW_NONE != eusart_flow_mode && ZERO_INIT == eusart_rx_throttled)
+                {
+                    Eusart_Flow_Rx_Throttle();
+                }else{/* Nothing */}
+#endif
+            }
+        }
+    }
+    eusart_rx_head = l_head;
+    //An overrun stops the receiver until CREN is toggled
+    if(RCSTAbits.OERR)
+    {
+        eusart_stats.rx_overrun_errors++;
+        Eusart_Async_Rx_Restart();
+    }else{/* Nothing */}
+
+    //CallBack func gets called every time new bytes are in the RX ring.
+    if(EUSART_RXInterruptHandler)
+    {
+        EUSART_RXInterruptHandler();
+    }else{/* Nothing */}
+    if(l_framing_error && EUSART_FramingErrorHandler)
+    {
+        EUSART_FramingErrorHandler();
+    }else{/* Nothing */}
+#else
     //CallBack func gets called every time this ISR executes.
     if(EUSART_RXInterruptHandler)
     {
@@ -438,4 +1456,173 @@ void EUSART_RX_ISR(void)
     {
         EUSART_FramingErrorHandler();
     }else{/* Nothing */}
-}
\ No newline at end of file
+#endif
+}
+
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief Writes the 9th bit of a TX ring slot.
+ * 
+ */
+static inline void Eusart_Tx_Bit9_Write(uint8 index, uint8 bit9)
+{
+    index &= EUSART_TX_BUFFER_MASK;
+    if(bit9)
+    {
+        eusart_tx_bit9[index >> 3] |= (uint8)(1U << (index & 0x07U));
+    }
+    else
+    {
+        eusart_tx_bit9[index >> 3] &= (uint8)~(1U << (index & 0x07U));
+    }
+}
+
+/**
+ * @brief Selects or deselects the node on an address byte, EUSART_RX_ISR() context.
+ * 
+ */
+static inline void Eusart_Multidrop_Address(uint8 address)
+{
+    if(address == eusart_node_address || address == eusart_broadcast_address)
+    {
+        //Selected: receive the data bytes that follow
+        RCSTAbits.ADDEN = 0;
+        if(EUSART_AddressHandler)
+        {
+            EUSART_AddressHandler(address);
+        }else{/* Nothing */}
+    }
+    else
+    {
+        //Another node is addressed, sleep until the next address byte
+        RCSTAbits.ADDEN = 1;
+    }
+}
+
+/**
+ * @brief Configures Timer3 as the driver-enable one-shot, stopped until EUSART_TX_ISR() arms it.
+ * 
+ * The period covers EUSART_DE_RELEASE_BITS bit times at the current rate. Slow rates use the
+ * prescaler, below that the period is clamped and simply repeats until TRMT is set.
+ */
+static Std_ReturnType Eusart_De_Timer_Init(void)
+{
+    Std_ReturnType ret = E_OK;
+    //Timer3 counts instruction cycles, Fosc / 4
+    uint32 l_ticks = (EUSART_DE_RELEASE_BITS * eusart_bit_clocks) / 4U;
+    uint8 l_prescaler = TIMER3_PRESCALER_DIV_1;
+
+    while(l_ticks > 0xFFFFUL && l_prescaler < TIMER3_PRESCALER_DIV_8)
+    {
+        l_ticks >>= 1;
+        l_prescaler++;
+    }
+    if(l_ticks > 0xFFFFUL)
+    {
+        l_ticks = 0xFFFFUL;
+    }else{/* Nothing */}
+    eusart_de_timer.TMR3_InterruptHandler = Eusart_De_Timer_Handler;
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+    //Same priority as the TX interrupt arming it
+    eusart_de_timer.priority = IPR1bits.TXIP ? INTERRUPT_HIGH_PRIORITY : INTERRUPT_LOW_PRIORITY;
+#endif
+    eusart_de_timer.prescaler_val = (timer3_prescaler_t)l_prescaler;
+    eusart_de_timer.timer3_preload = (uint16)(0x10000UL - l_ticks);
+    eusart_de_timer.timer3_mode = TIMER3_TIMER_MODE_CFG;
+    eusart_de_timer.timer3_counter_sync = TIMER3_SYNC_COUNTER_CFG;
+    eusart_de_timer.timer3_rw_mode = TIMER3_16BITS_RW_MODE_CFG;
+    ret = Timer3_Init(&eusart_de_timer);
+    TIMER3_MODULE_DISABLE();
+    return ret;
+}
+
+/**
+ * @brief Releases the driver-enable pin after the stop bit of the last byte, TMR3_ISR() context.
+ * 
+ */
+static void Eusart_De_Timer_Handler(void)
+{
+    if(eusart_tx_tail != eusart_tx_head)
+    {
+        //Bytes queued meanwhile keep the bus, EUSART_TX_ISR() arms the one-shot again
+        TIMER3_MODULE_DISABLE();
+    }
+    else if(TXSTAbits.TRMT)
+    {
+        TIMER3_MODULE_DISABLE();
+        gpio_pin_write(&eusart_de_pin, GPIO_LOW);
+    }
+    else
+    {
+        /* Still shifting, TMR3_ISR() reloaded the period */
+    }
+}
+#endif
+
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief Consumes XON/XOFF from the peer, EUSART_RX_ISR() context.
+ * 
+ * @return uint8 1 when the byte was a flow control character.
+ */
+static inline uint8 Eusart_Flow_Rx_Filter(uint8 data)
+{
+    uint8 l_consumed = ZERO_INIT;
+
+    if(EUSART_FLOW_XON_XOFF == eusart_flow_mode && (EUSART_XON == data || EUSART_XOFF == data))
+    {
+        l_consumed = 1;
+        eusart_tx_paused = (uint8)(EUSART_XOFF == data);
+        if(EUSART_XON == data)
+        {
+            EUSART_TX_INTERRUPT_ENABLE();
+        }else{/* Nothing */}
+    }else{/* Nothing */}
+    return l_consumed;
+}
+
+/**
+ * @brief Asks the peer to stop sending, EUSART_RX_ISR() context or RX interrupt disabled.
+ * 
+ */
+static inline void Eusart_Flow_Rx_Throttle(void)
+{
+    eusart_rx_throttled = 1;
+    eusart_stats.rx_throttle_events++;
+    if(EUSART_FLOW_RTS_CTS == eusart_flow_mode)
+    {
+        gpio_pin_write(&eusart_rts_pin, GPIO_HIGH);
+    }
+    else
+    {
+        eusart_flow_char = EUSART_XOFF;
+        EUSART_TX_INTERRUPT_ENABLE();
+    }
+}
+
+/**
+ * @brief Lets the peer send again, called by Eusart_Read() below the low watermark.
+ * 
+ */
+static void Eusart_Flow_Rx_Release(void)
+{
+    uint8 l_rx_int_status = PIE1bits.RCIE;
+
+    //EUSART_RX_ISR() may have throttled again in between
+    EUSART_RX_INTERRUPT_DISABLE();
+    if(eusart_rx_throttled && (uint8)(eusart_rx_head - eusart_rx_tail) <= EUSART_CFG_RX_LOW_WATERMARK)
+    {
+        eusart_rx_throttled = ZERO_INIT;
+        if(EUSART_FLOW_RTS_CTS == eusart_flow_mode)
+        {
+            gpio_pin_write(&eusart_rts_pin, GPIO_LOW);
+        }
+        else
+        {
+            eusart_flow_char = EUSART_XON;
+            EUSART_TX_INTERRUPT_ENABLE();
+        }
+    }else{/* Nothing */}
+    PIE1bits.RCIE = l_rx_int_status;
+}
+#endif
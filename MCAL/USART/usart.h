@@ -11,6 +11,7 @@
 /* -------------- Includes -------------- */
 #include "usart_cfg.h"
 #include "../GPIO/gpio.h"
+#include "../TIMER3/timer3.h"
 #include "../interrupt/internal_interrupt.h"
 
 /* -------------- Macro Declarations ------------- */
@@ -51,7 +52,68 @@
 #define EUSART_OVERRUN_ER_DETECTED_CFG    1
 #define EUSART_OVERRUN_ER_CLEAR_CFG       0
 
+#if EUSART_CFG_BUFFERED==EUSART_CFG_FEATURE_ENABLE
+#if (EUSART_CFG_TX_BUFFER_SIZE < 2) || (EUSART_CFG_TX_BUFFER_SIZE > 128) || \
+    (EUSART_CFG_TX_BUFFER_SIZE & (EUSART_CFG_TX_BUFFER_SIZE - 1))
+#error "EUSART_CFG_TX_BUFFER_SIZE must be a power of two between 2 and 128"
+#endif
+#if (EUSART_CFG_RX_BUFFER_SIZE < 2) || (EUSART_CFG_RX_BUFFER_SIZE > 128) || \
+    (EUSART_CFG_RX_BUFFER_SIZE & (EUSART_CFG_RX_BUFFER_SIZE - 1))
+#error "EUSART_CFG_RX_BUFFER_SIZE must be a power of two between 2 and 128"
+#endif
+#define EUSART_TX_BUFFER_MASK   (EUSART_CFG_TX_BUFFER_SIZE - 1U)
+#define EUSART_RX_BUFFER_MASK   (EUSART_CFG_RX_BUFFER_SIZE - 1U)
+#endif
+
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+#if EUSART_CFG_BUFFERED!=EUSART_CFG_FEATURE_ENABLE
+#error "EUSART_CFG_MULTIDROP needs EUSART_CFG_BUFFERED"
+#endif
+#if TIMER3_INTERRUPT_ENABLE_FEATURE!=INTERRUPT_FEATURE_ENABLE
+#error "EUSART_CFG_MULTIDROP needs TIMER3_INTERRUPT_ENABLE_FEATURE to release the driver-enable pin"
+#endif
+//Bit times from loading the shift register to the driver-enable release: 11 bits and a margin.
+#define EUSART_DE_RELEASE_BITS  12U
+//One 9th bit per TX ring slot, set for address bytes.
+#define EUSART_TX_BIT9_BYTES    ((EUSART_CFG_TX_BUFFER_SIZE + 7U) / 8U)
+#endif
+
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+#if EUSART_CFG_BUFFERED!=EUSART_CFG_FEATURE_ENABLE
+#error "EUSART_CFG_FLOW_CONTROL needs EUSART_CFG_BUFFERED"
+#endif
+#if (EUSART_CFG_RX_HIGH_WATERMARK > EUSART_CFG_RX_BUFFER_SIZE) || \
+    (EUSART_CFG_RX_LOW_WATERMARK >= EUSART_CFG_RX_HIGH_WATERMARK)
+#error "EUSART_CFG_RX_LOW_WATERMARK < EUSART_CFG_RX_HIGH_WATERMARK <= EUSART_CFG_RX_BUFFER_SIZE"
+#endif
+//Software flow control characters (DC1, DC3).
+#define EUSART_XON              0x11U
+#define EUSART_XOFF             0x13U
+#endif
+
 /* -------------- Macro Functions Declarations -------------- */
+/**
+ * @brief Baud rate generator math
+ * @note  EUSART_BRG_VALUE() gives the rounded SPBRGH:SPBRG value for a divisor
+ *        (64, 16 or 4, see usart_baudrate_gen_t). EUSART_BAUD_RATE_X1M() is the achieved
+ *        rate times 1000000, it needs 64-bit arithmetic and is meant for #if checks only.
+ *        _XTAL_FREQ is unsigned so #if does the math unsigned: the error is checked on
+ *        each side of the requested rate instead of through an absolute value.
+ */
+#define EUSART_BRG_VALUE(_BAUD, _DIV)       (((_XTAL_FREQ) + ((_DIV) * (_BAUD)) / 2) / ((_DIV) * (_BAUD)) - 1)
+#define EUSART_BAUD_RATE_X1M(_BAUD, _DIV)   (((_XTAL_FREQ) * 1000000) / ((_DIV) * (EUSART_BRG_VALUE(_BAUD, _DIV) + 1)))
+#define EUSART_BAUD_ABS(_X)                 (((_X) < 0) ? -(_X) : (_X))
+
+//The 16-bit high speed generator (divisor 4) has the finest steps for any usable rate
+#if EUSART_BRG_VALUE(EUSART_CFG_BAUDRATE, 4) > 65535
+#error "EUSART_CFG_BAUDRATE is too low for _XTAL_FREQ"
+#elif (EUSART_BAUD_RATE_X1M(EUSART_CFG_BAUDRATE, 4) > ((EUSART_CFG_BAUDRATE) * 1000000)) && \
+      ((EUSART_BAUD_RATE_X1M(EUSART_CFG_BAUDRATE, 4) - ((EUSART_CFG_BAUDRATE) * 1000000)) / (EUSART_CFG_BAUDRATE) > EUSART_CFG_BAUD_MAX_ERROR_PPM)
+#error "EUSART_CFG_BAUDRATE can't be generated from _XTAL_FREQ within EUSART_CFG_BAUD_MAX_ERROR_PPM"
+#elif (EUSART_BAUD_RATE_X1M(EUSART_CFG_BAUDRATE, 4) < ((EUSART_CFG_BAUDRATE) * 1000000)) && \
+      ((((EUSART_CFG_BAUDRATE) * 1000000) - EUSART_BAUD_RATE_X1M(EUSART_CFG_BAUDRATE, 4)) / (EUSART_CFG_BAUDRATE) > EUSART_CFG_BAUD_MAX_ERROR_PPM)
+#error "EUSART_CFG_BAUDRATE can't be generated from _XTAL_FREQ within EUSART_CFG_BAUD_MAX_ERROR_PPM"
+#endif
 
 
 /* -------------- Data Types Declarations ---------------------- */
@@ -67,6 +129,7 @@ typedef enum
     EUSART_ASYNC_16BITS_HIGH_SPEED_BAUDRATE,
     EUSART_SYNC_8BITS_BAUDRATE,
     EUSART_SYNC_16BITS_BAUDRATE,
+    EUSART_ASYNC_AUTO_BAUDRATE          /* The asynchronous mode with the lowest error */
 }usart_baudrate_gen_t;
 
 /**
@@ -109,6 +172,72 @@ typedef union
     uint8 err_status;
 }usart_error_status_cfg_t;
 
+#if EUSART_CFG_BUFFERED==EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief Receive Statistics, counted by EUSART_RX_ISR()
+ */
+typedef struct
+{
+    uint16 rx_overrun_errors;   /* OERR events, the receiver was restarted */
+    uint16 rx_framing_errors;   /* Bytes received with FERR, discarded */
+    uint16 rx_dropped;          /* Bytes lost because the RX ring was full */
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+    uint16 rx_throttle_events;  /* Times the high watermark throttled the sender */
+    uint32 rx_throttled_ticks;  /* Eusart_Flow_Tick() calls while throttled */
+#endif
+}usart_stats_t;
+#endif
+
+#if EUSART_CFG_AUTOBAUD==EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief Auto-Baud Detection State
+ */
+typedef enum
+{
+    EUSART_AUTOBAUD_IDLE = 0,
+    EUSART_AUTOBAUD_RUNNING,        /* Waiting for the 0x55 sync character */
+    EUSART_AUTOBAUD_LOCKED,         /* A standard rate was detected and applied */
+    EUSART_AUTOBAUD_FAILED          /* Overflow or non-standard rate, the previous rate is restored */
+}usart_autobaud_state_t;
+#endif
+
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief Multidrop (RS-485) Configurations Structure
+ */
+typedef struct
+{
+    uint8 node_address;                 /* Address bytes selecting this node */
+    uint8 broadcast_address;            /* Also selects this node, set it to node_address if unused */
+    uint8 de_pin_enable : 1;            /* Drive a transceiver driver-enable pin */
+    uint8 multidrop_reserved : 7;
+    pin_config_t de_pin;                /* High while transmitting, released by a Timer3 one-shot */
+    void (* EUSART_AddressHandler)(uint8 address);  /* Called in EUSART_RX_ISR() when selected */
+}usart_multidrop_t;
+#endif
+
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief Flow Control Mode
+ */
+typedef enum
+{
+    EUSART_FLOW_NONE = 0,
+    EUSART_FLOW_RTS_CTS,            /* GPIO handshake lines, low = ready */
+    EUSART_FLOW_XON_XOFF            /* In-band DC1/DC3, the data must not contain them */
+}usart_flow_mode_t;
+
+/**
+ * @brief Flow Control Configurations Structure
+ */
+typedef struct
+{
+    usart_flow_mode_t mode;
+    pin_config_t rts_pin;           /* Output, driven high while the RX ring is above the watermark */
+    pin_config_t cts_pin;           /* Input, the transmitter pauses while it reads high */
+}usart_flow_t;
+#endif
+
 typedef struct
 {
     uint32 baudrate;                          // Desired Baud Rate
@@ -197,5 +326,240 @@ Std_ReturnType Eusart_Async_Receive_NonBlocking(uint8 *data);
  */
 Std_ReturnType Eusart_Async_SendByte_NonBlocking(uint8 data);
 
+/**
+ * @brief Reports the baud rate set by Eusart_Async_Init().
+ * 
+ * SPBRGH:SPBRG is the rounded integer divisor of _XTAL_FREQ, the error is the achieved
+ * rate relative to the requested one (positive when faster). Keep it within about
+ * +/-20000 ppm (2%) for reliable frames with another device of similar accuracy.
+ * 
+ * @param achieved_baud A pointer to store the achieved baud rate in bit/s (can be NULL).
+ * @param error_ppm A pointer to store the error in ppm (can be NULL).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Get_Baudrate(uint32 *achieved_baud, sint32 *error_ppm);
+
+#if EUSART_CFG_AUTOBAUD==EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief Starts auto-baud detection, the host must then send 0x55 ('U').
+ * 
+ * The hardware measures the sync character with the baud rate generator and loads
+ * SPBRGH:SPBRG. The RX interrupt is held off until Eusart_AutoBaud_Poll() reports the end
+ * of the detection, so the sync character never reaches the RX ring. The measured count is
+ * always 16 bits: with the 8-bit generator, a count above 255 moves the EUSART to the 16-bit
+ * generator (BRG16) at the same BRGH. When the counter overflows (ABDOVF) the detection
+ * fails, a slower rate then needs BRGH cleared before the start.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The detection is running.
+ *         - E_NOT_OK: The EUSART isn't in asynchronous mode or a detection is running.
+ */
+Std_ReturnType Eusart_AutoBaud_Start(void);
+
+/**
+ * @brief Advances the auto-baud detection, call it from the main loop.
+ * 
+ * The measured rate is snapped to the nearest standard rate (1200 to 115200) within
+ * EUSART_CFG_AUTOBAUD_TOLERANCE_PPM, and the generator is reprogrammed with the
+ * rounded value of that rate.
+ * 
+ * @param state A pointer to store the detection state.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_AutoBaud_Poll(usart_autobaud_state_t *state);
+
+/**
+ * @brief Retrieves the standard rate locked by the last successful detection.
+ * 
+ * @param baudrate A pointer to store the rate in bit/s.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: No rate detected yet, or NULL pointer.
+ */
+Std_ReturnType Eusart_AutoBaud_Get_Rate(uint32 *baudrate);
+#endif
+
+#if EUSART_CFG_BUFFERED==EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief Queues bytes for transmission and returns immediately.
+ * 
+ * @note The RX interrupt must be enabled in the configuration (usart_rx_interrupt_enable),
+ *       the TX interrupt is enabled by the driver whenever the TX ring holds data.
+ * The bytes are copied into the TX ring and EUSART_TX_ISR() moves them to TXREG, one
+ * interrupt per byte. The message is queued whole or not at all, so messages written
+ * from the main loop never interleave. EUSART_TXInterruptHandler is called when the ring
+ * has been drained into the transmitter.
+ * 
+ * @param buf The bytes to send.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: All the bytes were queued.
+ *         - E_NOT_OK: Not enough room in the TX ring (nothing queued), or NULL buffer.
+ */
+Std_ReturnType Eusart_Write(const uint8 *buf, uint8 len);
+
+/**
+ * @brief Queues a null-terminated string for transmission and returns immediately.
+ * 
+ * @param str A string to send.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The string was queued.
+ *         - E_NOT_OK: Not enough room in the TX ring (nothing queued), or NULL string.
+ */
+Std_ReturnType Eusart_Write_String(const uint8 *str);
+
+/**
+ * @brief Reads received bytes from the RX ring.
+ * 
+ * @param buf A buffer to store the bytes.
+ * @param len Size of the buffer.
+ * @param read_len A pointer to store the number of bytes read (0 when the ring is empty).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Read(uint8 *buf, uint8 len, uint8 *read_len);
+
+/**
+ * @brief Reports the fill levels of the rings.
+ * 
+ * @param rx_available A pointer to store the number of unread bytes (can be NULL).
+ * @param tx_free A pointer to store the free space of the TX ring (can be NULL).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Buffer_Status(uint8 *rx_available, uint8 *tx_free);
+
+/**
+ * @brief Retrieves the receive statistics.
+ * 
+ * @param stats A pointer to store the statistics.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Get_Stats(usart_stats_t *stats);
+
+/**
+ * @brief Routes every received byte to a handler instead of the RX ring.
+ * 
+ * The handler runs in EUSART_RX_ISR() context, once per byte, so protocol layers can
+ * parse the stream in place without copying it out of the RX ring first.
+ * 
+ * @param handler The byte handler, NULL routes the bytes back to the RX ring.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Set_Rx_Byte_Handler(void (*handler)(uint8 data));
+#endif
+
+#if EUSART_CFG_MULTIDROP==EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief Switches the initialized EUSART to 9-bit multidrop mode.
+ * 
+ * Address bytes have the 9th bit set. With RCSTA ADDEN set, the receiver ignores every
+ * byte without the 9th bit, so data addressed to other nodes never interrupts this one.
+ * An address matching node_address or broadcast_address clears ADDEN and the following
+ * data bytes reach the RX ring (or the RX byte handler); any other address sets ADDEN
+ * again. Address bytes are never stored.
+ * 
+ * With the driver-enable pin, Timer3 is taken for the release: EUSART_TX_ISR() starts it
+ * as a one-shot of about one character time when the last byte enters the shift register,
+ * and its interrupt drops the pin once TRMT is set. The turnaround is bounded by one bit
+ * time plus the interrupt latency, without polling. Call it after Eusart_Async_Init() and
+ * after every baud rate change, the one-shot length is taken from SPBRGH:SPBRG. Timer3 runs
+ * at the priority of the TX interrupt and can't be used for anything else then.
+ * 
+ * @param _multidrop A pointer to the Multidrop Configurations Structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Multidrop_Init(const usart_multidrop_t *_multidrop);
+
+/**
+ * @brief Leaves multidrop mode, every byte is received again (9-bit mode is kept).
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Multidrop_DeInit(void);
+
+/**
+ * @brief Deselects the node once its message is complete, only address bytes interrupt.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Multidrop mode isn't active.
+ */
+Std_ReturnType Eusart_Multidrop_Listen(void);
+
+/**
+ * @brief Queues an address byte (9th bit set) followed by data bytes.
+ * 
+ * Data bytes queued later with Eusart_Write() continue the same message.
+ * With the driver-enable pin, the pin is driven high here and released once TRMT reports
+ * that the stop bit of the last byte has left the shift register.
+ * 
+ * @param address The destination node address.
+ * @param buf The data bytes (can be NULL when len is 0).
+ * @param len Number of data bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The message was queued.
+ *         - E_NOT_OK: Multidrop mode isn't active, or not enough room in the TX ring.
+ */
+Std_ReturnType Eusart_Multidrop_Send(uint8 address, const uint8 *buf, uint8 len);
+#endif
+
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief Starts flow control on the initialized EUSART.
+ * 
+ * Receive side: when EUSART_RX_ISR() fills the RX ring up to EUSART_CFG_RX_HIGH_WATERMARK,
+ * RTS is driven high (or XOFF is sent ahead of the queued bytes); once Eusart_Read() has
+ * drained it down to EUSART_CFG_RX_LOW_WATERMARK, RTS goes low again (or XON is sent).
+ * The bytes above the high watermark absorb the sender reaction time.
+ * Transmit side: EUSART_TX_ISR() stops loading TXREG while CTS is high (or after an XOFF
+ * was received, until XON). XON and XOFF bytes are consumed and never reach the RX ring.
+ * Bytes routed to an RX byte handler bypass the ring and are never throttled.
+ * Not available in multidrop mode. Eusart_Async_Init() stops flow control, call this again
+ * after a re-init.
+ * 
+ * @param _flow A pointer to the Flow Control Configurations Structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid mode, or multidrop mode is active.
+ */
+Std_ReturnType Eusart_Flow_Init(const usart_flow_t *_flow);
+
+/**
+ * @brief Stops flow control, RTS is left low and a paused transmitter resumes.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Flow_DeInit(void);
+
+/**
+ * @brief Flow control time base, call it periodically (a timer ISR or the main loop).
+ * 
+ * Counts the time spent throttled in rx_throttled_ticks and, with RTS/CTS, resumes the
+ * transmitter once CTS goes low again (there is no interrupt on the CTS pin).
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Flow_Tick(void);
+#endif
+
 #endif	/* USART_H */
 
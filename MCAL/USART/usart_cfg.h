@@ -11,6 +11,32 @@
 /* -------------- Includes -------------- */
 
 /* -------------- Macro Declarations ------------- */
+#define EUSART_CFG_FEATURE_ENABLE       1U
+#define EUSART_CFG_FEATURE_DISABLE      0U
+
+//Interrupt-driven TX/RX ring buffers (Eusart_Write(), Eusart_Read()).
+#define EUSART_CFG_BUFFERED             EUSART_CFG_FEATURE_ENABLE
+//Ring buffer sizes in bytes (power of two, 2 to 128).
+#define EUSART_CFG_TX_BUFFER_SIZE       64U
+#define EUSART_CFG_RX_BUFFER_SIZE       32U
+
+//Build-time baud rate check: the best asynchronous mode must reach it within the limit.
+#define EUSART_CFG_BAUDRATE             9600UL
+#define EUSART_CFG_BAUD_MAX_ERROR_PPM   20000L
+
+//Auto-baud detection from a 0x55 sync character (BAUDCON ABDEN).
+#define EUSART_CFG_AUTOBAUD             EUSART_CFG_FEATURE_ENABLE
+//A measured rate must be this close to a standard rate to be accepted.
+#define EUSART_CFG_AUTOBAUD_TOLERANCE_PPM   30000UL
+
+//9-bit multidrop (RS-485) addressing with RCSTA ADDEN, needs EUSART_CFG_BUFFERED.
+#define EUSART_CFG_MULTIDROP            EUSART_CFG_FEATURE_ENABLE
+
+//RTS/CTS or XON/XOFF receive throttling driven by the RX ring fill level, needs EUSART_CFG_BUFFERED.
+#define EUSART_CFG_FLOW_CONTROL         EUSART_CFG_FEATURE_ENABLE
+//Unread bytes throttling the sender, and releasing it again.
+#define EUSART_CFG_RX_HIGH_WATERMARK    24U
+#define EUSART_CFG_RX_LOW_WATERMARK     8U
 
 /* -------------- Macro Functions Declarations -------------- */
 
@@ -23,6 +23,53 @@ void __interrupt() InterruptManagerHigh(void)
     {
         INT2_ISR();
     }
+    //Each peripheral source is served by the handler of the priority its IP bit selects
+    /*_________________________ TIMER START _________________________________*/
+    if(INTERRUPT_ENABLE == INTCONbits.TMR0IE && INTERRUPT_OCCURRED == INTCONbits.TMR0IF
+    && INTERRUPT_HIGH_PRIORITY == INTCON2bits.TMR0IP)
+    {
+        TMR0_ISR(); /* TIMER0 INTERRUPT */
+    }
+    if(INTERRUPT_ENABLE == PIE1bits.TMR2IE && INTERRUPT_OCCURRED == PIR1bits.TMR2IF
+    && INTERRUPT_HIGH_PRIORITY == IPR1bits.TMR2IP)
+    {
+        TMR2_ISR(); /* TIMER2 INTERRUPT */
+    }
+    if(INTERRUPT_ENABLE == PIE2bits.TMR3IE && INTERRUPT_OCCURRED == PIR2bits.TMR3IF
+    && INTERRUPT_HIGH_PRIORITY == IPR2bits.TMR3IP)
+    {
+        TMR3_ISR(); /* TIMER3 INTERRUPT */
+    }
+    /*_________________________ TIMER END _________________________________*/
+    /*_________________________ EUSART START _________________________________*/
+    if(INTERRUPT_ENABLE == PIE1bits.TXIE && INTERRUPT_OCCURRED == PIR1bits.TXIF
+    && INTERRUPT_HIGH_PRIORITY == IPR1bits.TXIP)
+    {
+        EUSART_TX_ISR(); /* EUSART TX INTERRUPT */
+    }
+    if(INTERRUPT_ENABLE == PIE1bits.RCIE && INTERRUPT_OCCURRED == PIR1bits.RCIF
+    && INTERRUPT_HIGH_PRIORITY == IPR1bits.RCIP)
+    {
+        EUSART_RX_ISR(); /* EUSART RX INTERRUPT */
+    }
+    /*_________________________ EUSART END _________________________________*/
+    /*_________________________ MSSP START _________________________________*/
+    if(INTERRUPT_ENABLE == PIE1bits.SSPIE && INTERRUPT_OCCURRED == PIR1bits.SSPIF
+    && INTERRUPT_HIGH_PRIORITY == IPR1bits.SSPIP && SSPCON1bits.SSPM <= 5)
+    {
+        SPI_ISR(); /* SPI INTERRUPT */
+    }
+    if(INTERRUPT_ENABLE == PIE1bits.SSPIE && INTERRUPT_OCCURRED == PIR1bits.SSPIF
+    && INTERRUPT_HIGH_PRIORITY == IPR1bits.SSPIP && SSPCON1bits.SSPM >= 6)
+    {
+        I2C_ISR(); /* I2C INTERRUPT */
+    }
+    if(INTERRUPT_ENABLE == PIE2bits.BCLIE && INTERRUPT_OCCURRED == PIR2bits.BCLIF
+    && INTERRUPT_HIGH_PRIORITY == IPR2bits.BCLIP)
+    {
+        I2C_BUS_COL_ISR(); /* I2C BUS COLLISION INTERRUPT */
+    }
+    /*_________________________ MSSP END _________________________________*/
 }
 
 void __interrupt(low_priority) InterruptManagerLow(void)
@@ -31,6 +78,52 @@ void __interrupt(low_priority) InterruptManagerLow(void)
     {
         INT1_ISR();
     }
+    /*_________________________ TIMER START _________________________________*/
+    if(INTERRUPT_ENABLE == INTCONbits.TMR0IE && INTERRUPT_OCCURRED == INTCONbits.TMR0IF
+    && INTERRUPT_LOW_PRIORITY == INTCON2bits.TMR0IP)
+    {
+        TMR0_ISR(); /* TIMER0 INTERRUPT */
+    }
+    if(INTERRUPT_ENABLE == PIE1bits.TMR2IE && INTERRUPT_OCCURRED == PIR1bits.TMR2IF
+    && INTERRUPT_LOW_PRIORITY == IPR1bits.TMR2IP)
+    {
+        TMR2_ISR(); /* TIMER2 INTERRUPT */
+    }
+    if(INTERRUPT_ENABLE == PIE2bits.TMR3IE && INTERRUPT_OCCURRED == PIR2bits.TMR3IF
+    && INTERRUPT_LOW_PRIORITY == IPR2bits.TMR3IP)
+    {
+        TMR3_ISR(); /* TIMER3 INTERRUPT */
+    }
+    /*_________________________ TIMER END _________________________________*/
+    /*_________________________ EUSART START _________________________________*/
+    if(INTERRUPT_ENABLE == PIE1bits.TXIE && INTERRUPT_OCCURRED == PIR1bits.TXIF
+    && INTERRUPT_LOW_PRIORITY == IPR1bits.TXIP)
+    {
+        EUSART_TX_ISR(); /* EUSART TX INTERRUPT */
+    }
+    if(INTERRUPT_ENABLE == PIE1bits.RCIE && INTERRUPT_OCCURRED == PIR1bits.RCIF
+    && INTERRUPT_LOW_PRIORITY == IPR1bits.RCIP)
+    {
+        EUSART_RX_ISR(); /* EUSART RX INTERRUPT */
+    }
+    /*_________________________ EUSART END _________________________________*/
+    /*_________________________ MSSP START _________________________________*/
+    if(INTERRUPT_ENABLE == PIE1bits.SSPIE && INTERRUPT_OCCURRED == PIR1bits.SSPIF
+    && INTERRUPT_LOW_PRIORITY == IPR1bits.SSPIP && SSPCON1bits.SSPM <= 5)
+    {
+        SPI_ISR(); /* SPI INTERRUPT */
+    }
+    if(INTERRUPT_ENABLE == PIE1bits.SSPIE && INTERRUPT_OCCURRED == PIR1bits.SSPIF
+    && INTERRUPT_LOW_PRIORITY == IPR1bits.SSPIP && SSPCON1bits.SSPM >= 6)
+    {
+        I2C_ISR(); /* I2C INTERRUPT */
+    }
+    if(INTERRUPT_ENABLE == PIE2bits.BCLIE && INTERRUPT_OCCURRED == PIR2bits.BCLIF
+    && INTERRUPT_LOW_PRIORITY == IPR2bits.BCLIP)
+    {
+        I2C_BUS_COL_ISR(); /* I2C BUS COLLISION INTERRUPT */
+    }
+    /*_________________________ MSSP END _________________________________*/
 }
 
 #else
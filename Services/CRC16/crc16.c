@@ -0,0 +1,60 @@
+/*
+ * File:   crc16.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+#include "crc16.h"
+
+//CRC of every 4-bit value, reflected polynomial 0xA001
+static const uint16 crc16_nibble_table[16] = {
+    0x0000, 0xCC01, 0xD801, 0x1400, 0xF001, 0x3C00, 0x2800, 0xE401,
+    0xA001, 0x6C00, 0x7800, 0xB401, 0x5000, 0x9C01, 0x8801, 0x4400
+};
+
+/**
+ * @brief Adds one byte to a running CRC.
+ *
+ * @param crc The running CRC.
+ * @param data The next byte.
+ * @return uint16 The updated CRC.
+ */
+uint16 CRC16_Update(uint16 crc, uint8 data)
+{
+    crc ^= data;
+    //Low nibble then high nibble
+    crc = (uint16)((crc >> 4) ^ crc16_nibble_table[crc & 0x0F]);
+    crc = (uint16)((crc >> 4) ^ crc16_nibble_table[crc & 0x0F]);
+    return crc;
+}
+
+/**
+ * @brief Calculates the CRC of a buffer.
+ *
+ * @param data The buffer.
+ * @param len Number of bytes.
+ * @param crc A pointer to store the CRC, sent low byte first.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CRC16_Calculate(const uint8 *data, uint16 len, uint16 *crc)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_crc = CRC16_INIT_VALUE;
+    uint16 l_index = ZERO_INIT;
+
+    if(NULL == data || NULL == crc)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(l_index = 0; l_index < len; l_index++)
+        {
+            l_crc = CRC16_Update(l_crc, data[l_index]);
+        }
+        *crc = l_crc;
+    }
+    return ret;
+}
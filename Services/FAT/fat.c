@@ -0,0 +1,559 @@
+/*
+ * File:   fat.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+
+#include "fat.h"
+
+static Std_ReturnType fat_load(fat_volume_t *volume, uint32 sector);
+static uint8 fat_is_boot_sector(const uint8 *buf);
+static uint16 fat_le16(const uint8 *buf);
+static uint32 fat_le32(const uint8 *buf);
+static uint8 fat_cluster_valid(const fat_volume_t *volume, uint32 cluster);
+static Std_ReturnType fat_next_cluster(fat_volume_t *volume, uint32 cluster, uint32 *next);
+static Std_ReturnType fat_file_sector(fat_file_t *file, uint32 *sector);
+static void fat_open_root(fat_volume_t *volume, fat_file_t *file);
+static Std_ReturnType fat_make_name(const char **path, uint8 *name);
+static Std_ReturnType fat_find(fat_file_t *dir, const uint8 *name, fat_file_t *file);
+
+/**
+ * @brief Mounts the FAT16 or FAT32 volume of a block device.
+ *
+ * @param volume A pointer to the volume to fill.
+ * @param device A pointer to the block device, it must stay valid while the volume is used.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Read error, no FAT volume, FAT12, or sectors other than 512 bytes.
+ */
+Std_ReturnType FAT_Mount(fat_volume_t *volume, const fat_block_device_t *device)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_partition = ZERO_INIT;
+    uint32 l_total = ZERO_INIT;
+    uint32 l_fat_size = ZERO_INIT;
+    uint32 l_fats_end = ZERO_INIT;
+    uint8 l_sectors_per_cluster = ZERO_INIT;
+
+    if(NULL == volume || NULL == device || NULL == device->FAT_ReadBlock)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        volume->device = device;
+        volume->type = FAT_TYPE_NONE;
+        volume->buffer_sector = FAT_NO_SECTOR;
+        ret = fat_load(volume, 0);
+#if FAT_CFG_MBR==FAT_CFG_FEATURE_ENABLE
+        //Not a boot sector: an MBR, the volume is the first partition
+        if(E_OK == ret && ZERO_INIT == fat_is_boot_sector(volume->buffer))
+        {
+            l_partition = fat_le32(&volume->buffer[454]);
+            if(ZERO_INIT == l_partition)
+            {
+                ret = E_NOT_OK;
+            }
+            else
+            {
+                ret = fat_load(volume, l_partition);
+            }
+        }else{/* Nothing */}
+#endif
+        if(E_OK == ret && fat_is_boot_sector(volume->buffer))
+        {
+            //BIOS parameter block
+            l_sectors_per_cluster = volume->buffer[13];
+            volume->cluster_shift = ZERO_INIT;
+            while((1U << volume->cluster_shift) != l_sectors_per_cluster)
+            {
+                volume->cluster_shift++;
+            }
+            volume->root_entries = fat_le16(&volume->buffer[17]);
+            l_total = fat_le16(&volume->buffer[19]);
+            if(ZERO_INIT == l_total)
+            {
+                l_total = fat_le32(&volume->buffer[32]);
+            }else{/* Nothing */}
+            l_fat_size = fat_le16(&volume->buffer[22]);
+            if(ZERO_INIT == l_fat_size)
+            {
+                l_fat_size = fat_le32(&volume->buffer[36]);
+            }else{/* Nothing */}
+            volume->fat_start = l_partition + fat_le16(&volume->buffer[14]);
+            l_fats_end = volume->fat_start + (volume->buffer[16] * l_fat_size);
+            //The FAT16 root directory sits between the FATs and the data
+            volume->data_start = l_fats_end +
+                                 ((((uint32)volume->root_entries * FAT_DIR_ENTRY_SIZE) + FAT_SECTOR_SIZE - 1U)
+                                  >> FAT_SECTOR_SHIFT);
+            if(l_total > (volume->data_start - l_partition))
+            {
+                volume->cluster_count = (l_total - (volume->data_start - l_partition)) >> volume->cluster_shift;
+            }
+            else
+            {
+                volume->cluster_count = ZERO_INIT;
+            }
+            //The type only depends on the number of clusters
+            if(volume->cluster_count < FAT_FAT16_MIN_CLUSTERS)
+            {
+                ret = E_NOT_OK;
+            }
+            else if(volume->cluster_count < FAT_FAT32_MIN_CLUSTERS)
+            {
+                volume->type = FAT_TYPE_FAT16;
+                volume->root_start = l_fats_end;
+            }
+            else
+            {
+#if FAT_CFG_FAT32==FAT_CFG_FEATURE_ENABLE
+                volume->type = FAT_TYPE_FAT32;
+                volume->root_start = fat_le32(&volume->buffer[44]);
+#else
+                ret = E_NOT_OK;
+#endif
+            }
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Opens a file or a directory.
+ *
+ * @param volume A pointer to the mounted volume.
+ * @param file A pointer to the file to fill, positioned at its start.
+ * @param path The path from the root directory, "" or "/" opens the root directory.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Not found, invalid 8.3 name, or read error.
+ */
+Std_ReturnType FAT_Open(fat_volume_t *volume, fat_file_t *file, const char *path)
+{
+    Std_ReturnType ret = E_OK;
+    fat_file_t l_dir;
+    uint8 l_name[FAT_NAME_SIZE];
+
+    if(NULL == volume || NULL == file || NULL == path || FAT_TYPE_NONE == volume->type)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        fat_open_root(volume, file);
+        while('/' == *path)
+        {
+            path++;
+        }
+        //One directory level per name
+        while(E_OK == ret && *path)
+        {
+            if(file->attributes & FAT_ATTR_DIRECTORY)
+            {
+                ret = fat_make_name(&path, l_name);
+            }
+            else
+            {
+                ret = E_NOT_OK;
+            }
+            if(E_OK == ret)
+            {
+                l_dir = *file;
+                ret = fat_find(&l_dir, l_name, file);
+            }else{/* Nothing */}
+            while('/' == *path)
+            {
+                path++;
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads bytes from the current position.
+ *
+ * @param file A pointer to the open file.
+ * @param buf A buffer to store the bytes.
+ * @param len Number of bytes requested.
+ * @param read A pointer to store the number of bytes read, less than len at the end of the file.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Read error or broken cluster chain.
+ */
+Std_ReturnType FAT_Read(fat_file_t *file, uint8 *buf, uint16 len, uint16 *read)
+{
+    Std_ReturnType ret = E_OK;
+    fat_volume_t *l_volume = NULL;
+    uint32 l_sector = ZERO_INIT;
+    uint16 l_offset = ZERO_INIT;
+    uint16 l_count = ZERO_INIT;
+
+    if(NULL == file || NULL == file->volume || NULL == buf || NULL == read)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_volume = file->volume;
+        *read = ZERO_INIT;
+        if(file->position >= file->size)
+        {
+            len = ZERO_INIT;
+        }
+        else if(len > (file->size - file->position))
+        {
+            len = (uint16)(file->size - file->position);
+        }
+        else
+        {
+            /* Nothing */
+        }
+        while(E_OK == ret && len)
+        {
+            ret = fat_file_sector(file, &l_sector);
+            if(E_OK == ret && FAT_NO_SECTOR == l_sector)
+            {
+                //End of the chain, only a directory has no size to stop it first
+                if(ZERO_INIT == (file->attributes & FAT_ATTR_DIRECTORY))
+                {
+                    ret = E_NOT_OK;
+                }else{/* Nothing */}
+                len = ZERO_INIT;
+            }
+            else if(E_OK == ret)
+            {
+                l_offset = (uint16)(file->position & (FAT_SECTOR_SIZE - 1U));
+                l_count = FAT_SECTOR_SIZE - l_offset;
+                if(l_count > len)
+                {
+                    l_count = len;
+                }else{/* Nothing */}
+                if(FAT_SECTOR_SIZE == l_count && l_sector != l_volume->buffer_sector)
+                {
+                    //Whole sector: straight into the caller buffer, the buffered sector stays
+                    ret = l_volume->device->FAT_ReadBlock(l_volume->device->context, l_sector, buf);
+                }
+                else
+                {
+                    ret = fat_load(l_volume, l_sector);
+                    if(E_OK == ret)
+                    {
+                        memcpy(buf, &l_volume->buffer[l_offset], l_count);
+                    }else{/* Nothing */}
+                }
+                if(E_OK == ret)
+                {
+                    buf += l_count;
+                    file->position += l_count;
+                    *read += l_count;
+                    len -= l_count;
+                }else{/* Nothing */}
+            }
+            else
+            {
+                /* Nothing */
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Moves the position of a file.
+ *
+ * @param file A pointer to the open file.
+ * @param position The new position from the start of the file.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: The position is past the end of the file.
+ */
+Std_ReturnType FAT_Seek(fat_file_t *file, uint32 position)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == file || position > file->size)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        file->position = position;
+    }
+    return ret;
+}
+
+/**
+ * @brief Helper function to bring a sector into the volume buffer, unless it is already there
+ */
+static Std_ReturnType fat_load(fat_volume_t *volume, uint32 sector)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(sector != volume->buffer_sector)
+    {
+        volume->buffer_sector = FAT_NO_SECTOR;
+        ret = volume->device->FAT_ReadBlock(volume->device->context, sector, volume->buffer);
+        if(E_OK == ret)
+        {
+            volume->buffer_sector = sector;
+        }else{/* Nothing */}
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief Helper function to check for a FAT boot sector with 512-byte sectors
+ */
+static uint8 fat_is_boot_sector(const uint8 *buf)
+{
+    uint8 l_cluster = buf[13];
+
+    return (uint8)(0x55U == buf[510] && 0xAAU == buf[511] &&
+                   (0xEBU == buf[0] || 0xE9U == buf[0]) &&
+                   FAT_SECTOR_SIZE == fat_le16(&buf[11]) &&
+                   ZERO_INIT != l_cluster && ZERO_INIT == (l_cluster & (uint8)(l_cluster - 1U)) &&
+                   ZERO_INIT != fat_le16(&buf[14]) && ZERO_INIT != buf[16]);
+}
+
+/**
+ * @brief Helper function to read a little endian 16-bit field
+ */
+static uint16 fat_le16(const uint8 *buf)
+{
+    return (uint16)(((uint16)buf[1] << 8) | buf[0]);
+}
+
+/**
+ * @brief Helper function to read a little endian 32-bit field
+ */
+static uint32 fat_le32(const uint8 *buf)
+{
+    return ((uint32)fat_le16(&buf[2]) << 16) | fat_le16(buf);
+}
+
+/**
+ * @brief Helper function to check that a cluster number points into the data area
+ */
+static uint8 fat_cluster_valid(const fat_volume_t *volume, uint32 cluster)
+{
+    return (uint8)(cluster >= 2U && (cluster - 2U) < volume->cluster_count);
+}
+
+/**
+ * @brief Helper function to read the FAT entry of a cluster, the next cluster of the chain
+ */
+static Std_ReturnType fat_next_cluster(fat_volume_t *volume, uint32 cluster, uint32 *next)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_offset = ZERO_INIT;
+
+#if FAT_CFG_FAT32==FAT_CFG_FEATURE_ENABLE
+    if(FAT_TYPE_FAT32 == volume->type)
+    {
+        //4 bytes per entry, the top 4 bits are reserved
+        l_offset = (uint16)((cluster << 2) & (FAT_SECTOR_SIZE - 1U));
+        ret = fat_load(volume, volume->fat_start + (cluster >> (FAT_SECTOR_SHIFT - 2U)));
+        *next = fat_le32(&volume->buffer[l_offset]) & 0x0FFFFFFFUL;
+    }
+    else
+#endif
+    {
+        l_offset = (uint16)((cluster << 1) & (FAT_SECTOR_SIZE - 1U));
+        ret = fat_load(volume, volume->fat_start + (cluster >> (FAT_SECTOR_SHIFT - 1U)));
+        *next = fat_le16(&volume->buffer[l_offset]);
+    }
+    return ret;
+}
+
+/**
+ * @brief Helper function to find the sector holding the file position
+ *
+ * The current cluster is kept in the file, so a sequential read only reads the FAT when it
+ * crosses into the next cluster. The sector is FAT_NO_SECTOR past the end of the chain.
+ */
+static Std_ReturnType fat_file_sector(fat_file_t *file, uint32 *sector)
+{
+    Std_ReturnType ret = E_OK;
+    fat_volume_t *l_volume = file->volume;
+    uint32 l_index = file->position >> (FAT_SECTOR_SHIFT + l_volume->cluster_shift);
+
+    if(ZERO_INIT == file->first_cluster && (file->attributes & FAT_ATTR_DIRECTORY))
+    {
+        //FAT16 root directory, a fixed area
+        *sector = l_volume->root_start + (file->position >> FAT_SECTOR_SHIFT);
+    }
+    else
+    {
+        //Going back means starting over, the chain only links forward
+        if(ZERO_INIT == file->cluster || l_index < file->cluster_index)
+        {
+            file->cluster = file->first_cluster;
+            file->cluster_index = ZERO_INIT;
+        }else{/* Nothing */}
+        while(E_OK == ret && file->cluster_index < l_index && fat_cluster_valid(l_volume, file->cluster))
+        {
+            ret = fat_next_cluster(l_volume, file->cluster, &file->cluster);
+            file->cluster_index++;
+        }
+        if(E_OK == ret && fat_cluster_valid(l_volume, file->cluster))
+        {
+            *sector = l_volume->data_start + ((file->cluster - 2U) << l_volume->cluster_shift) +
+                      ((file->position >> FAT_SECTOR_SHIFT) & ((1UL << l_volume->cluster_shift) - 1U));
+        }
+        else
+        {
+            //End of chain markers are above the data area, free and bad entries below
+            if(E_OK == ret && file->cluster < 2U)
+            {
+                ret = E_NOT_OK;
+            }else{/* Nothing */}
+            *sector = FAT_NO_SECTOR;
+            file->cluster = ZERO_INIT;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Helper function to open the root directory
+ */
+static void fat_open_root(fat_volume_t *volume, fat_file_t *file)
+{
+    file->volume = volume;
+    file->attributes = FAT_ATTR_DIRECTORY;
+    file->position = ZERO_INIT;
+    file->cluster = ZERO_INIT;
+    file->cluster_index = ZERO_INIT;
+#if FAT_CFG_FAT32==FAT_CFG_FEATURE_ENABLE
+    if(FAT_TYPE_FAT32 == volume->type)
+    {
+        file->first_cluster = volume->root_start;
+        file->size = FAT_DIRECTORY_SIZE;
+    }
+    else
+#endif
+    {
+        file->first_cluster = ZERO_INIT;
+        file->size = (uint32)volume->root_entries * FAT_DIR_ENTRY_SIZE;
+    }
+}
+
+/**
+ * @brief Helper function to turn the next path element into a space padded 8.3 name
+ */
+static Std_ReturnType fat_make_name(const char **path, uint8 *name)
+{
+    Std_ReturnType ret = E_OK;
+    const char *l_path = *path;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_limit = 8U;
+    char l_char = ZERO_INIT;
+
+    memset(name, ' ', FAT_NAME_SIZE);
+    while(E_OK == ret && '\0' != *l_path && '/' != *l_path)
+    {
+        l_char = *l_path++;
+        if('.' == l_char)
+        {
+            //One dot, after a base name
+            if(FAT_NAME_SIZE == l_limit || ZERO_INIT == l_index)
+            {
+                ret = E_NOT_OK;
+            }
+            else
+            {
+                l_index = 8U;
+                l_limit = FAT_NAME_SIZE;
+            }
+        }
+        else if(l_index >= l_limit)
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            if(l_char >= 'a' && l_char <= 'z')
+            {
+                l_char = (char)(l_char - 'a' + 'A');
+            }else{/* Nothing */}
+            name[l_index++] = (uint8)l_char;
+        }
+    }
+    if(ZERO_INIT == l_index)
+    {
+        ret = E_NOT_OK;
+    }else{/* Nothing */}
+    *path = l_path;
+    return ret;
+}
+
+/**
+ * @brief Helper function to look for a name in a directory and open the entry
+ */
+static Std_ReturnType fat_find(fat_file_t *dir, const uint8 *name, fat_file_t *file)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    fat_volume_t *l_volume = dir->volume;
+    const uint8 *l_entry = NULL;
+    uint32 l_sector = ZERO_INIT;
+    uint8 l_done = ZERO_INIT;
+
+    dir->position = ZERO_INIT;
+    while(ZERO_INIT == l_done)
+    {
+        if(dir->position >= dir->size || E_OK != fat_file_sector(dir, &l_sector) ||
+           FAT_NO_SECTOR == l_sector || E_OK != fat_load(l_volume, l_sector))
+        {
+            l_done = 1;
+        }
+        else
+        {
+            l_entry = &l_volume->buffer[dir->position & (FAT_SECTOR_SIZE - 1U)];
+            if(FAT_ENTRY_END == l_entry[0])
+            {
+                l_done = 1;
+            }
+            else if(FAT_ENTRY_DELETED != l_entry[0] &&
+                    FAT_ATTR_LONG_NAME != (l_entry[11] & FAT_ATTR_LONG_NAME) &&
+                    ZERO_INIT == (l_entry[11] & FAT_ATTR_VOLUME_ID) &&
+                    ZERO_INIT == memcmp(l_entry, name, FAT_NAME_SIZE))
+            {
+                file->volume = l_volume;
+                file->attributes = l_entry[11];
+                file->first_cluster = fat_le16(&l_entry[26]);
+#if FAT_CFG_FAT32==FAT_CFG_FEATURE_ENABLE
+                if(FAT_TYPE_FAT32 == l_volume->type)
+                {
+                    file->first_cluster |= (uint32)fat_le16(&l_entry[20]) << 16;
+                }else{/* Nothing */}
+#endif
+                file->size = fat_le32(&l_entry[28]);
+                file->position = ZERO_INIT;
+                file->cluster = ZERO_INIT;
+                file->cluster_index = ZERO_INIT;
+                if(file->attributes & FAT_ATTR_DIRECTORY)
+                {
+                    file->size = FAT_DIRECTORY_SIZE;
+                    //".." of a first level directory points to the root as cluster 0
+                    if(ZERO_INIT == file->first_cluster)
+                    {
+                        fat_open_root(l_volume, file);
+                    }else{/* Nothing */}
+                }else{/* Nothing */}
+                ret = E_OK;
+                l_done = 1;
+            }
+            else
+            {
+                dir->position += FAT_DIR_ENTRY_SIZE;
+            }
+        }
+    }
+    return ret;
+}
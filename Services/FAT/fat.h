@@ -0,0 +1,160 @@
+/*
+ * File:   fat.h
+ * Author: Mohamed Sameh
+ *
+ * Read-only FAT16/FAT32 file reader for configuration files and lookup tables.
+ * Everything goes through the single 512-byte sector buffer of the volume: FAT entries
+ * are read one sector at a time as the cluster chain is walked (the FAT itself is never
+ * cached), and a sector is only read again when another one was needed in between. Files
+ * stream out with FAT_Read(), whole aligned sectors go straight into the caller buffer.
+ *
+ * Paths are '/' separated 8.3 names ("CONFIG/TABLE.BIN"), matched case-insensitively.
+ * Long file names are ignored, the short alias of a long name must be used.
+ *
+ * The volume sits on a block device, e.g. an SD card:
+ *   static Std_ReturnType Card_Read(void *context, uint32 sector, uint8 *buf)
+ *   {
+ *       return sd_card_read((sd_card_t *)context, sector, buf, 1);
+ *   }
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef FAT_H
+#define	FAT_H
+
+/* -------------- Includes -------------- */
+#include "../../MCAL/std_types.h"
+#include "fat_cfg.h"
+
+/* -------------- Macro Declarations ------------- */
+#define FAT_SECTOR_SIZE             512U
+#define FAT_SECTOR_SHIFT            9U
+#define FAT_DIR_ENTRY_SIZE          32U
+#define FAT_NAME_SIZE               11U     /* 8.3 name, space padded, without the dot */
+#define FAT_NO_SECTOR               0xFFFFFFFFUL
+//Size given to directories, they end with their cluster chain
+#define FAT_DIRECTORY_SIZE          0xFFFFFFFFUL
+
+//Directory entry attributes
+#define FAT_ATTR_READ_ONLY          0x01U
+#define FAT_ATTR_HIDDEN             0x02U
+#define FAT_ATTR_SYSTEM             0x04U
+#define FAT_ATTR_VOLUME_ID          0x08U
+#define FAT_ATTR_DIRECTORY          0x10U
+#define FAT_ATTR_ARCHIVE            0x20U
+#define FAT_ATTR_LONG_NAME          0x0FU
+
+//Directory entry first byte
+#define FAT_ENTRY_END               0x00U   /* No entries after this one */
+#define FAT_ENTRY_DELETED           0xE5U
+
+//Clusters counts deciding the FAT type
+#define FAT_FAT16_MIN_CLUSTERS      4085UL
+#define FAT_FAT32_MIN_CLUSTERS      65525UL
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+/**
+ * @brief Block Device, reads 512-byte sectors
+ */
+typedef struct
+{
+    Std_ReturnType (* FAT_ReadBlock)(void *context, uint32 sector, uint8 *buf);
+    void *context;                      /* Passed back to FAT_ReadBlock */
+}fat_block_device_t;
+
+/**
+ * @brief FAT Types
+ */
+typedef enum
+{
+    FAT_TYPE_NONE = 0,
+    FAT_TYPE_FAT16,
+    FAT_TYPE_FAT32
+}fat_type_t;
+
+/**
+ * @brief FAT Volume, filled by FAT_Mount()
+ */
+typedef struct
+{
+    const fat_block_device_t *device;
+    fat_type_t type;
+    uint8 cluster_shift;                /* log2 of the sectors per cluster */
+    uint16 root_entries;                /* FAT16 root directory entries */
+    uint32 fat_start;                   /* First sector of the first FAT */
+    uint32 root_start;                  /* FAT16 root directory sector, FAT32 root cluster */
+    uint32 data_start;                  /* First sector of cluster 2 */
+    uint32 cluster_count;
+    uint32 buffer_sector;               /* Sector held by the buffer, FAT_NO_SECTOR if none */
+    uint8 buffer[FAT_SECTOR_SIZE];
+}fat_volume_t;
+
+/**
+ * @brief Open File or Directory, filled by FAT_Open()
+ */
+typedef struct
+{
+    fat_volume_t *volume;
+    uint32 first_cluster;               /* 0 for an empty file and the FAT16 root directory */
+    uint32 size;                        /* Bytes, directories read until the end of their chain */
+    uint32 position;
+    uint32 cluster;                     /* Cluster holding cluster_index, 0 before the first access */
+    uint32 cluster_index;               /* Cluster number within the file */
+    uint8 attributes;
+}fat_file_t;
+
+/* -------------- Functions Declarations --------------*/
+/**
+ * @brief Mounts the FAT16 or FAT32 volume of a block device.
+ *
+ * @param volume A pointer to the volume to fill.
+ * @param device A pointer to the block device, it must stay valid while the volume is used.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Read error, no FAT volume, FAT12, or sectors other than 512 bytes.
+ */
+Std_ReturnType FAT_Mount(fat_volume_t *volume, const fat_block_device_t *device);
+
+/**
+ * @brief Opens a file or a directory.
+ *
+ * @param volume A pointer to the mounted volume.
+ * @param file A pointer to the file to fill, positioned at its start.
+ * @param path The path from the root directory, "" or "/" opens the root directory.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Not found, invalid 8.3 name, or read error.
+ */
+Std_ReturnType FAT_Open(fat_volume_t *volume, fat_file_t *file, const char *path);
+
+/**
+ * @brief Reads bytes from the current position.
+ *
+ * @param file A pointer to the open file.
+ * @param buf A buffer to store the bytes.
+ * @param len Number of bytes requested.
+ * @param read A pointer to store the number of bytes read, less than len at the end of the file.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Read error or broken cluster chain.
+ */
+Std_ReturnType FAT_Read(fat_file_t *file, uint8 *buf, uint16 len, uint16 *read);
+
+/**
+ * @brief Moves the position of a file.
+ *
+ * Seeking forward walks the chain from the current cluster, seeking backward from the
+ * first cluster. The chain is only walked on the next read.
+ *
+ * @param file A pointer to the open file.
+ * @param position The new position from the start of the file.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: The position is past the end of the file.
+ */
+Std_ReturnType FAT_Seek(fat_file_t *file, uint32 position);
+
+#endif	/* FAT_H */
@@ -0,0 +1,29 @@
+/*
+ * File:   fat_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef FAT_CFG_H
+#define	FAT_CFG_H
+
+/* -------------- Includes -------------- */
+
+/* -------------- Macro Declarations ------------- */
+#define FAT_CFG_FEATURE_ENABLE          1U
+#define FAT_CFG_FEATURE_DISABLE         0U
+
+//FAT32 volumes (cards of 2 GB and more are usually formatted FAT32).
+#define FAT_CFG_FAT32                   FAT_CFG_FEATURE_ENABLE
+//Look for the volume in the first partition of an MBR partition table, as on SD cards.
+#define FAT_CFG_MBR                     FAT_CFG_FEATURE_ENABLE
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+
+/* -------------- Functions Declarations --------------*/
+
+
+#endif	/* FAT_CFG_H */
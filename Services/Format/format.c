@@ -0,0 +1,403 @@
+/*
+ * File:   format.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+#include "format.h"
+
+#define FORMAT_FLAG_LEFT        0x01U
+#define FORMAT_FLAG_ZERO        0x02U
+#define FORMAT_FLAG_LONG        0x04U
+#define FORMAT_FLAG_UPPER       0x08U
+
+static const uint32 format_pow10[FORMAT_Q_MAX_DECIMALS + 1] = {1UL, 10UL, 100UL, 1000UL, 10000UL};
+
+static void Format_Buffer_PutChar(void *context, uint8 data);
+static uint8 Format_Unsigned_To_Digits(uint32 value, uint8 base, uint8 upper, uint8 *digits);
+static uint8 Format_Fixed_To_Digits(uint32 magnitude, uint8 frac_bits, uint8 decimals, uint8 *digits);
+static void Format_Field(const format_sink_t *sink, uint8 sign, const uint8 *body, uint8 len,
+                         uint8 width, uint8 flags);
+
+/**
+ * @brief Formats the arguments into a sink.
+ *
+ * @param sink A pointer to the output sink.
+ * @param fmt The format string.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid parameters or an unsupported conversion (printed as is).
+ */
+Std_ReturnType Format_Print(const format_sink_t *sink, const char *fmt, ...)
+{
+    Std_ReturnType ret = E_OK;
+    va_list l_args;
+
+    va_start(l_args, fmt);
+    ret = Format_VPrint(sink, fmt, l_args);
+    va_end(l_args);
+    return ret;
+}
+
+/**
+ * @brief Formats a va_list into a sink.
+ *
+ * @param sink A pointer to the output sink.
+ * @param fmt The format string.
+ * @param args The arguments.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid parameters or an unsupported conversion (printed as is).
+ */
+Std_ReturnType Format_VPrint(const format_sink_t *sink, const char *fmt, va_list args)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_digits[16];
+    uint8 l_flags = ZERO_INIT;
+    uint8 l_width = ZERO_INIT;
+    uint8 l_precision = ZERO_INIT;
+    uint8 l_has_precision = ZERO_INIT;
+    uint8 l_frac_bits = ZERO_INIT;
+    uint8 l_len = ZERO_INIT;
+    uint8 l_sign = ZERO_INIT;
+    uint8 l_char = ZERO_INIT;
+    uint32 l_value = ZERO_INIT;
+    sint32 l_signed = ZERO_INIT;
+    const char *l_str = NULL;
+
+    if(NULL == sink || NULL == sink->Format_PutChar || NULL == fmt)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        while('\0' != *fmt)
+        {
+            if('%' != *fmt)
+            {
+                sink->Format_PutChar(sink->context, (uint8)*fmt);
+                fmt++;
+                continue;
+            }else{/* Nothing */}
+            fmt++;
+            //Flags
+            l_flags = ZERO_INIT;
+            while('-' == *fmt || '0' == *fmt)
+            {
+                l_flags |= ('-' == *fmt) ? FORMAT_FLAG_LEFT : FORMAT_FLAG_ZERO;
+                fmt++;
+            }
+            //Width and precision
+            l_width = ZERO_INIT;
+            while(*fmt >= '0' && *fmt <= '9')
+            {
+                l_width = (uint8)(l_width * 10 + (*fmt - '0'));
+                fmt++;
+            }
+            l_has_precision = ZERO_INIT;
+            l_precision = ZERO_INIT;
+            if('.' == *fmt)
+            {
+                fmt++;
+                l_has_precision = 1;
+                while(*fmt >= '0' && *fmt <= '9')
+                {
+                    l_precision = (uint8)(l_precision * 10 + (*fmt - '0'));
+                    fmt++;
+                }
+            }else{/* Nothing */}
+            if(l_width > FORMAT_MAX_WIDTH)
+            {
+                l_width = FORMAT_MAX_WIDTH;
+            }else{/* Nothing */}
+            if('l' == *fmt)
+            {
+                l_flags |= FORMAT_FLAG_LONG;
+                fmt++;
+            }else{/* Nothing */}
+
+            l_sign = ZERO_INIT;
+            switch(*fmt)
+            {
+                case 'u':
+                    l_value = (l_flags & FORMAT_FLAG_LONG) ? va_arg(args, unsigned long) :
+                                                             (uint32)va_arg(args, unsigned int);
+                    l_len = Format_Unsigned_To_Digits(l_value, 10, 0, l_digits);
+                    Format_Field(sink, 0, l_digits, l_len, l_width, l_flags);
+                    break;
+                case 'd':
+                    l_signed = (l_flags & FORMAT_FLAG_LONG) ? va_arg(args, long) :
+                                                              (sint32)va_arg(args, int);
+                    //Magnitude without overflowing on the most negative value
+                    l_value = (l_signed < 0) ? ((uint32)(-(l_signed + 1)) + 1UL) : (uint32)l_signed;
+                    l_sign = (l_signed < 0) ? '-' : 0;
+                    l_len = Format_Unsigned_To_Digits(l_value, 10, 0, l_digits);
+                    Format_Field(sink, l_sign, l_digits, l_len, l_width, l_flags);
+                    break;
+                case 'X':
+                    l_flags |= FORMAT_FLAG_UPPER;
+                    /* fall through */
+                case 'x':
+                    l_value = (l_flags & FORMAT_FLAG_LONG) ? va_arg(args, unsigned long) :
+                                                             (uint32)va_arg(args, unsigned int);
+                    l_len = Format_Unsigned_To_Digits(l_value, 16, (l_flags & FORMAT_FLAG_UPPER), l_digits);
+                    Format_Field(sink, 0, l_digits, l_len, l_width, l_flags);
+                    break;
+                case 'q':
+                    l_signed = (l_flags & FORMAT_FLAG_LONG) ? va_arg(args, long) :
+                                                              (sint32)(sint16)va_arg(args, int);
+                    //Fraction bits follow the conversion character
+                    l_frac_bits = ZERO_INIT;
+                    while(*(fmt + 1) >= '0' && *(fmt + 1) <= '9')
+                    {
+                        fmt++;
+                        l_frac_bits = (uint8)(l_frac_bits * 10 + (*fmt - '0'));
+                    }
+                    if(ZERO_INIT == l_frac_bits || l_frac_bits > FORMAT_Q_MAX_BITS)
+                    {
+                        l_frac_bits = FORMAT_Q_DEFAULT_BITS;
+                    }else{/* Nothing */}
+                    if(0 == l_has_precision)
+                    {
+                        l_precision = FORMAT_Q_DEFAULT_DECIMALS;
+                    }
+                    else if(l_precision > FORMAT_Q_MAX_DECIMALS)
+                    {
+                        l_precision = FORMAT_Q_MAX_DECIMALS;
+                    }else{/* Nothing */}
+                    l_value = (l_signed < 0) ? ((uint32)(-(l_signed + 1)) + 1UL) : (uint32)l_signed;
+                    l_sign = (l_signed < 0) ? '-' : 0;
+                    l_len = Format_Fixed_To_Digits(l_value, l_frac_bits, l_precision, l_digits);
+                    Format_Field(sink, l_sign, l_digits, l_len, l_width, l_flags);
+                    break;
+                case 'c':
+                    l_char = (uint8)va_arg(args, int);
+                    Format_Field(sink, 0, &l_char, 1, l_width, (uint8)(l_flags & FORMAT_FLAG_LEFT));
+                    break;
+                case 's':
+                    l_str = va_arg(args, const char *);
+                    if(NULL == l_str)
+                    {
+                        l_str = "(null)";
+                    }else{/* Nothing */}
+                    //Strings are streamed, only the padding needs their length
+                    l_len = ZERO_INIT;
+                    while('\0' != l_str[l_len] && l_len < 0xFF)
+                    {
+                        l_len++;
+                    }
+                    Format_Field(sink, 0, (const uint8 *)l_str, l_len, l_width, (uint8)(l_flags & FORMAT_FLAG_LEFT));
+                    break;
+                case '%':
+                    sink->Format_PutChar(sink->context, '%');
+                    break;
+                case '\0':
+                    //Lone '%' at the end of the format
+                    sink->Format_PutChar(sink->context, '%');
+                    ret = E_NOT_OK;
+                    fmt--;
+                    break;
+                default:
+                    sink->Format_PutChar(sink->context, '%');
+                    sink->Format_PutChar(sink->context, (uint8)*fmt);
+                    ret = E_NOT_OK;
+                    break;
+            }
+            fmt++;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Formats into a buffer, the result is always null-terminated.
+ *
+ * @param buffer The destination buffer.
+ * @param size Size of the buffer, the output is truncated to size - 1 characters.
+ * @param fmt The format string.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid parameters, unsupported conversion or truncated output.
+ */
+Std_ReturnType Format_To_Buffer(uint8 *buffer, uint8 size, const char *fmt, ...)
+{
+    Std_ReturnType ret = E_OK;
+    format_buffer_t l_context = {.buffer = buffer, .size = size, .length = 0, .truncated = 0};
+    format_sink_t l_sink = {.Format_PutChar = Format_Buffer_PutChar, .context = &l_context};
+    va_list l_args;
+
+    if(NULL == buffer || ZERO_INIT == size)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        va_start(l_args, fmt);
+        ret = Format_VPrint(&l_sink, fmt, l_args);
+        va_end(l_args);
+        //Format_Buffer_PutChar() keeps one byte for the terminator
+        buffer[l_context.length] = '\0';
+        if(l_context.truncated)
+        {
+            ret = E_NOT_OK;
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+#if FORMAT_CFG_UART_SINK==FORMAT_CFG_FEATURE_ENABLE
+/**
+ * @brief Sink writing into the EUSART TX ring, context is unused.
+ *
+ */
+void Format_Uart_PutChar(void *context, uint8 data)
+{
+#if EUSART_CFG_BUFFERED==EUSART_CFG_FEATURE_ENABLE
+    //Wait only when the TX ring is full
+    while(E_NOT_OK == Eusart_Write(&data, 1));
+#else
+    Eusart_Async_SendByte_Blocking(data);
+#endif
+}
+#endif
+
+#if FORMAT_CFG_LCD_SINK==FORMAT_CFG_FEATURE_ENABLE
+/**
+ * @brief Sink writing at the cursor of a 4-bit LCD, context is a const lcd_4bit_t pointer.
+ *
+ */
+void Format_Lcd_4bit_PutChar(void *context, uint8 data)
+{
+    lcd_4bit_send_char((const lcd_4bit_t *)context, data);
+}
+
+/**
+ * @brief Sink writing at the cursor of an 8-bit LCD, context is a const lcd_8bit_t pointer.
+ *
+ */
+void Format_Lcd_8bit_PutChar(void *context, uint8 data)
+{
+    lcd_8bit_send_char((const lcd_8bit_t *)context, data);
+}
+#endif
+
+/**
+ * @brief Sink of Format_To_Buffer(), keeps the last byte for the terminator.
+ *
+ */
+static void Format_Buffer_PutChar(void *context, uint8 data)
+{
+    format_buffer_t *l_context = (format_buffer_t *)context;
+
+    if((uint16)l_context->length + 1U < (uint16)l_context->size)
+    {
+        l_context->buffer[l_context->length] = data;
+        l_context->length++;
+    }
+    else
+    {
+        l_context->truncated = 1;
+    }
+}
+
+/**
+ * @brief Writes the digits of a value, most significant first.
+ *
+ * @return uint8 Number of digits.
+ */
+static uint8 Format_Unsigned_To_Digits(uint32 value, uint8 base, uint8 upper, uint8 *digits)
+{
+    uint8 l_reversed[10];
+    uint8 l_count = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_digit = ZERO_INIT;
+
+    do
+    {
+        l_digit = (uint8)(value % base);
+        l_reversed[l_count] = (uint8)((l_digit < 10) ? ('0' + l_digit) : ((upper ? 'A' : 'a') + l_digit - 10));
+        l_count++;
+        value /= base;
+    }while(value);
+    for(l_index = 0; l_index < l_count; l_index++)
+    {
+        digits[l_index] = l_reversed[l_count - 1 - l_index];
+    }
+    return l_count;
+}
+
+/**
+ * @brief Writes a fixed point magnitude as "integer.decimals", the last decimal rounded.
+ *
+ * @return uint8 Number of characters.
+ */
+static uint8 Format_Fixed_To_Digits(uint32 magnitude, uint8 frac_bits, uint8 decimals, uint8 *digits)
+{
+    uint32 l_integer = magnitude >> frac_bits;
+    uint32 l_fraction = magnitude & ((1UL << frac_bits) - 1UL);
+    uint32 l_scale = format_pow10[decimals];
+    uint8 l_len = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+
+    //fraction < 2^16 and scale <= 10^4, the product stays within 32 bits
+    l_fraction = (l_fraction * l_scale + (1UL << (frac_bits - 1))) >> frac_bits;
+    if(l_fraction >= l_scale)
+    {
+        //Rounded up to the next integer
+        l_fraction -= l_scale;
+        l_integer++;
+    }else{/* Nothing */}
+    l_len = Format_Unsigned_To_Digits(l_integer, 10, 0, digits);
+    if(decimals)
+    {
+        digits[l_len] = '.';
+        l_len++;
+        for(l_index = decimals; l_index > 0; l_index--)
+        {
+            digits[l_len + l_index - 1] = (uint8)('0' + (l_fraction % 10));
+            l_fraction /= 10;
+        }
+        l_len = (uint8)(l_len + decimals);
+    }else{/* Nothing */}
+    return l_len;
+}
+
+/**
+ * @brief Writes a field with its sign and padding.
+ *
+ */
+static void Format_Field(const format_sink_t *sink, uint8 sign, const uint8 *body, uint8 len,
+                         uint8 width, uint8 flags)
+{
+    uint8 l_total = (uint8)(len + (sign ? 1 : 0));
+    uint8 l_pad = (width > l_total) ? (uint8)(width - l_total) : 0;
+    uint8 l_index = ZERO_INIT;
+
+    if(0 == (flags & FORMAT_FLAG_LEFT) && 0 == (flags & FORMAT_FLAG_ZERO))
+    {
+        for(; l_pad > 0; l_pad--)
+        {
+            sink->Format_PutChar(sink->context, ' ');
+        }
+    }else{/* Nothing */}
+    if(sign)
+    {
+        sink->Format_PutChar(sink->context, sign);
+    }else{/* Nothing */}
+    if(0 == (flags & FORMAT_FLAG_LEFT))
+    {
+        //Zeros go between the sign and the digits
+        for(; l_pad > 0; l_pad--)
+        {
+            sink->Format_PutChar(sink->context, '0');
+        }
+    }else{/* Nothing */}
+    for(l_index = 0; l_index < len; l_index++)
+    {
+        sink->Format_PutChar(sink->context, body[l_index]);
+    }
+    for(; l_pad > 0; l_pad--)
+    {
+        sink->Format_PutChar(sink->context, ' ');
+    }
+}
@@ -0,0 +1,126 @@
+/*
+ * File:   format.h
+ * Author: Mohamed Sameh
+ *
+ * Small printf-style formatter writing character by character into a sink, so the output
+ * goes straight to the UART TX ring or the LCD without an intermediate string.
+ *
+ * Conversions: %[flags][width][.precision][l]type
+ *   flags     : '-' left justify, '0' pad with zeros
+ *   width     : minimum field width (up to 20)
+ *   l         : 32-bit argument (long), 16-bit (int) otherwise
+ *   %u %d     : unsigned / signed decimal
+ *   %x %X     : hexadecimal, lower / upper case
+ *   %c %s %%  : character, null-terminated string, percent sign
+ *   %q<n>     : signed fixed point with n fraction bits (1 to 16, default 8), printed with
+ *               'precision' decimals (0 to 4, default 2), e.g. "%.3q8" for a Q8.8 sint16,
+ *               "%lq16" for a Q16.16 sint32. The last decimal is rounded.
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef FORMAT_H
+#define	FORMAT_H
+
+/* -------------- Includes -------------- */
+#include <stdarg.h>
+#include "../../MCAL/std_types.h"
+#include "format_cfg.h"
+#if FORMAT_CFG_UART_SINK==FORMAT_CFG_FEATURE_ENABLE
+#include "../../MCAL/USART/usart.h"
+#endif
+#if FORMAT_CFG_LCD_SINK==FORMAT_CFG_FEATURE_ENABLE
+#include "../../HAL/Chr_LCD/chr_lcd.h"
+#endif
+
+/* -------------- Macro Declarations ------------- */
+#define FORMAT_MAX_WIDTH            20U
+#define FORMAT_Q_DEFAULT_BITS       8U
+#define FORMAT_Q_MAX_BITS           16U
+#define FORMAT_Q_DEFAULT_DECIMALS   2U
+#define FORMAT_Q_MAX_DECIMALS       4U
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+/**
+ * @brief Output Sink
+ */
+typedef struct
+{
+    void (* Format_PutChar)(void *context, uint8 data);    /* Writes one character */
+    void *context;                                          /* Passed back to Format_PutChar */
+}format_sink_t;
+
+/**
+ * @brief Context of the buffer sink used by Format_To_Buffer()
+ */
+typedef struct
+{
+    uint8 *buffer;
+    uint8 size;
+    uint8 length;
+    uint8 truncated;
+}format_buffer_t;
+
+/* -------------- Functions Declarations --------------*/
+/**
+ * @brief Formats the arguments into a sink.
+ *
+ * @param sink A pointer to the output sink.
+ * @param fmt The format string.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid parameters or an unsupported conversion (printed as is).
+ */
+Std_ReturnType Format_Print(const format_sink_t *sink, const char *fmt, ...);
+
+/**
+ * @brief Formats a va_list into a sink.
+ *
+ * @param sink A pointer to the output sink.
+ * @param fmt The format string.
+ * @param args The arguments.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid parameters or an unsupported conversion (printed as is).
+ */
+Std_ReturnType Format_VPrint(const format_sink_t *sink, const char *fmt, va_list args);
+
+/**
+ * @brief Formats into a buffer, the result is always null-terminated.
+ *
+ * @param buffer The destination buffer.
+ * @param size Size of the buffer, the output is truncated to size - 1 characters.
+ * @param fmt The format string.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid parameters, unsupported conversion or truncated output.
+ */
+Std_ReturnType Format_To_Buffer(uint8 *buffer, uint8 size, const char *fmt, ...);
+
+#if FORMAT_CFG_UART_SINK==FORMAT_CFG_FEATURE_ENABLE
+/**
+ * @brief Sink writing into the EUSART TX ring, context is unused.
+ *
+ * Waits only while the TX ring is full.
+ * Example: const format_sink_t uart = {Format_Uart_PutChar, NULL};
+ */
+void Format_Uart_PutChar(void *context, uint8 data);
+#endif
+
+#if FORMAT_CFG_LCD_SINK==FORMAT_CFG_FEATURE_ENABLE
+/**
+ * @brief Sink writing at the cursor of a 4-bit LCD, context is a const lcd_4bit_t pointer.
+ *
+ */
+void Format_Lcd_4bit_PutChar(void *context, uint8 data);
+
+/**
+ * @brief Sink writing at the cursor of an 8-bit LCD, context is a const lcd_8bit_t pointer.
+ *
+ */
+void Format_Lcd_8bit_PutChar(void *context, uint8 data);
+#endif
+
+#endif	/* FORMAT_H */
@@ -0,0 +1,28 @@
+/*
+ * File:   format_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef FORMAT_CFG_H
+#define	FORMAT_CFG_H
+
+/* -------------- Includes -------------- */
+
+/* -------------- Macro Declarations ------------- */
+#define FORMAT_CFG_FEATURE_ENABLE       1U
+#define FORMAT_CFG_FEATURE_DISABLE      0U
+
+//Ready-made sinks, each one pulls in its driver.
+#define FORMAT_CFG_UART_SINK            FORMAT_CFG_FEATURE_ENABLE
+#define FORMAT_CFG_LCD_SINK             FORMAT_CFG_FEATURE_ENABLE
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+
+/* -------------- Functions Declarations --------------*/
+
+
+#endif	/* FORMAT_CFG_H */
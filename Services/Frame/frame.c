@@ -0,0 +1,332 @@
+/*
+ * File:   frame.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+#include "frame.h"
+
+static void (*Frame_RxHandler)(void) = NULL;
+
+//Two frame buffers: EUSART_RX_ISR() decodes into one while the other holds the ready frame.
+static uint8 frame_buffers[2][FRAME_CFG_MAX_PAYLOAD + FRAME_CRC_SIZE];
+static volatile uint8 frame_rx_buffer = ZERO_INIT;  /* Buffer being decoded into */
+static volatile uint8 frame_ready_len = ZERO_INIT;  /* Payload length of the ready frame, 0 if none */
+//Decoder state, EUSART_RX_ISR() context only.
+static uint8 frame_rx_len = ZERO_INIT;
+static uint16 frame_rx_crc = CRC16_INIT_VALUE;
+static uint8 frame_cobs_code = ZERO_INIT;
+static uint8 frame_cobs_remaining = ZERO_INIT;
+static uint8 frame_rx_error = ZERO_INIT;
+static volatile frame_stats_t frame_stats;
+
+static void Frame_Rx_Byte(uint8 data);
+static inline void Frame_Rx_Store(uint8 data);
+static inline void Frame_Rx_Reset(void);
+static Std_ReturnType Frame_Emit_Range(const uint8 *payload, uint8 len, const uint8 *crc_bytes,
+                                       uint8 from, uint8 to);
+
+/**
+ * @brief Initializes the framing layer and attaches the decoder to the EUSART RX stream.
+ *
+ * @param _frame A pointer to the Frame Configurations Structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Frame_Init(const frame_t *_frame)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == _frame)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //Detach first, the decoder state is reset without the ISR running it
+        ret = Eusart_Set_Rx_Byte_Handler(NULL);
+        Frame_Rx_Reset();
+        frame_rx_buffer = ZERO_INIT;
+        frame_ready_len = ZERO_INIT;
+        frame_stats.rx_frames = ZERO_INIT;
+        frame_stats.rx_crc_errors = ZERO_INIT;
+        frame_stats.rx_resyncs = ZERO_INIT;
+        frame_stats.rx_dropped = ZERO_INIT;
+        frame_stats.tx_frames = ZERO_INIT;
+        Frame_RxHandler = _frame->Frame_RxHandler;
+        ret = Eusart_Set_Rx_Byte_Handler(Frame_Rx_Byte);
+    }
+    return ret;
+}
+
+/**
+ * @brief Detaches the decoder, received bytes go back to the EUSART RX ring.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Frame_DeInit(void)
+{
+    return Eusart_Set_Rx_Byte_Handler(NULL);
+}
+
+/**
+ * @brief Encodes a payload straight into the EUSART TX ring.
+ *
+ * @param payload The payload.
+ * @param len Payload length (1 to FRAME_CFG_MAX_PAYLOAD).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The frame was queued.
+ *         - E_NOT_OK: Invalid parameters or not enough room in the TX ring.
+ */
+Std_ReturnType Frame_Send(const uint8 *payload, uint8 len)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_crc = CRC16_INIT_VALUE;
+    uint8 l_crc_bytes[FRAME_CRC_SIZE] = {0, 0};
+    uint8 l_total = ZERO_INIT;
+    uint8 l_block_start = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_data = ZERO_INIT;
+    uint8 l_tx_free = ZERO_INIT;
+    uint8 l_code = ZERO_INIT;
+    const uint8 l_delimiter = FRAME_DELIMITER;
+
+    Eusart_Buffer_Status(NULL, &l_tx_free);
+    if(NULL == payload || ZERO_INIT == len || len > FRAME_CFG_MAX_PAYLOAD ||
+       (uint16)l_tx_free < (uint16)FRAME_ENCODED_SIZE(len))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //The payload is followed by its CRC, both are COBS encoded as one stream
+        l_total = (uint8)(len + FRAME_CRC_SIZE);
+        for(l_index = 0; l_index < l_total; l_index++)
+        {
+            if(l_index < len)
+            {
+                l_data = payload[l_index];
+                l_crc = CRC16_Update(l_crc, l_data);
+            }
+            else
+            {
+                if(l_index == len)
+                {
+                    //The whole payload is scanned, the CRC is final
+                    l_crc_bytes[0] = (uint8)(l_crc);
+                    l_crc_bytes[1] = (uint8)(l_crc >> 8);
+                }else{/* Nothing */}
+                l_data = l_crc_bytes[l_index - len];
+            }
+
+            if(FRAME_DELIMITER == l_data)
+            {
+                //The zero is replaced by the code byte of the block it ends
+                l_code = (uint8)(l_index - l_block_start + 1);
+                ret &= Eusart_Write(&l_code, 1);
+                ret &= Frame_Emit_Range(payload, len, l_crc_bytes, l_block_start, l_index);
+                l_block_start = (uint8)(l_index + 1);
+            }
+            else if((l_index - l_block_start + 1) == FRAME_COBS_MAX_BLOCK)
+            {
+                l_code = 0xFF;
+                ret &= Eusart_Write(&l_code, 1);
+                ret &= Frame_Emit_Range(payload, len, l_crc_bytes, l_block_start, (uint8)(l_index + 1));
+                l_block_start = (uint8)(l_index + 1);
+            }else{/* Nothing */}
+        }
+        //Last block and the delimiter
+        l_code = (uint8)(l_total - l_block_start + 1);
+        ret &= Eusart_Write(&l_code, 1);
+        ret &= Frame_Emit_Range(payload, len, l_crc_bytes, l_block_start, l_total);
+        ret &= Eusart_Write(&l_delimiter, 1);
+        frame_stats.tx_frames++;
+    }
+    return ret;
+}
+
+/**
+ * @brief Retrieves the last good frame.
+ *
+ * @param payload A buffer to store the payload.
+ * @param size Size of the buffer.
+ * @param len A pointer to store the payload length.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: A frame was read.
+ *         - E_NOT_OK: No frame is waiting, the buffer is too small, or invalid parameters.
+ */
+Std_ReturnType Frame_Receive(uint8 *payload, uint8 size, uint8 *len)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_len = frame_ready_len;
+    uint8 l_index = ZERO_INIT;
+    const uint8 *l_frame = NULL;
+
+    if(NULL == payload || NULL == len || ZERO_INIT == l_len || size < l_len)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //The ISR doesn't swap buffers while a frame is ready
+        l_frame = frame_buffers[frame_rx_buffer ^ 1U];
+        for(l_index = 0; l_index < l_len; l_index++)
+        {
+            payload[l_index] = l_frame[l_index];
+        }
+        *len = l_len;
+        //Release the buffer only after it has been copied
+        frame_ready_len = ZERO_INIT;
+    }
+    return ret;
+}
+
+/**
+ * @brief Retrieves the frame statistics.
+ *
+ * @param stats A pointer to store the statistics.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Frame_Get_Stats(frame_stats_t *stats)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_rx_int_status = PIE1bits.RCIE;
+
+    if(NULL == stats)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //The counters are updated by EUSART_RX_ISR(), copy them atomically
+        EUSART_RX_INTERRUPT_DISABLE();
+        stats->rx_frames = frame_stats.rx_frames;
+        stats->rx_crc_errors = frame_stats.rx_crc_errors;
+        stats->rx_resyncs = frame_stats.rx_resyncs;
+        stats->rx_dropped = frame_stats.rx_dropped;
+        stats->tx_frames = frame_stats.tx_frames;
+        PIE1bits.RCIE = l_rx_int_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief Streaming COBS decoder, called by EUSART_RX_ISR() for every received byte.
+ *
+ * @param data The received byte.
+ */
+static void Frame_Rx_Byte(uint8 data)
+{
+    if(FRAME_DELIMITER == data)
+    {
+        if(frame_rx_error || ZERO_INIT != frame_cobs_remaining)
+        {
+            //Noise, overflow or a truncated block: the frame is lost, resync here
+            frame_stats.rx_resyncs++;
+        }
+        else if(ZERO_INIT == frame_rx_len)
+        {
+            /* Back to back delimiters, nothing to do */
+        }
+        else if(frame_rx_len <= FRAME_CRC_SIZE)
+        {
+            frame_stats.rx_resyncs++;
+        }
+        else if(CRC16_GOOD_RESIDUE != frame_rx_crc)
+        {
+            frame_stats.rx_crc_errors++;
+        }
+        else if(ZERO_INIT != frame_ready_len)
+        {
+            frame_stats.rx_dropped++;
+        }
+        else
+        {
+            //Hand the frame over by swapping the buffers
+            frame_ready_len = (uint8)(frame_rx_len - FRAME_CRC_SIZE);
+            frame_rx_buffer ^= 1U;
+            frame_stats.rx_frames++;
+            if(Frame_RxHandler)
+            {
+                Frame_RxHandler();
+            }else{/* Nothing */}
+        }
+        Frame_Rx_Reset();
+    }
+    else if(frame_rx_error)
+    {
+        /* Skip to the next delimiter */
+    }
+    else if(ZERO_INIT == frame_cobs_remaining)
+    {
+        //Code byte: the previous block ended with an implicit zero unless it was full
+        if(ZERO_INIT != frame_cobs_code && 0xFF != frame_cobs_code)
+        {
+            Frame_Rx_Store(0x00);
+        }else{/* Nothing */}
+        frame_cobs_code = data;
+        frame_cobs_remaining = (uint8)(data - 1);
+    }
+    else
+    {
+        Frame_Rx_Store(data);
+        frame_cobs_remaining--;
+    }
+}
+
+/**
+ * @brief Stores a decoded byte and adds it to the running CRC.
+ *
+ */
+static inline void Frame_Rx_Store(uint8 data)
+{
+    if(frame_rx_len >= (FRAME_CFG_MAX_PAYLOAD + FRAME_CRC_SIZE))
+    {
+        frame_rx_error = 1;
+    }
+    else
+    {
+        frame_buffers[frame_rx_buffer][frame_rx_len] = data;
+        frame_rx_len++;
+        frame_rx_crc = CRC16_Update(frame_rx_crc, data);
+    }
+}
+
+/**
+ * @brief Prepares the decoder for the next frame.
+ *
+ */
+static inline void Frame_Rx_Reset(void)
+{
+    frame_rx_len = ZERO_INIT;
+    frame_rx_crc = CRC16_INIT_VALUE;
+    frame_cobs_code = ZERO_INIT;
+    frame_cobs_remaining = ZERO_INIT;
+    frame_rx_error = ZERO_INIT;
+}
+
+/**
+ * @brief Queues the bytes [from, to) of the payload + CRC stream.
+ *
+ */
+static Std_ReturnType Frame_Emit_Range(const uint8 *payload, uint8 len, const uint8 *crc_bytes,
+                                       uint8 from, uint8 to)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(from < len && from < to)
+    {
+        ret &= Eusart_Write(&payload[from], (uint8)(((to < len) ? to : len) - from));
+        from = len;
+    }else{/* Nothing */}
+    if(from < to)
+    {
+        ret &= Eusart_Write(&crc_bytes[from - len], (uint8)(to - from));
+    }else{/* Nothing */}
+    return ret;
+}
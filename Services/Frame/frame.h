@@ -0,0 +1,122 @@
+/*
+ * File:   frame.h
+ * Author: Mohamed Sameh
+ *
+ * Binary packet framing over the EUSART.
+ * On the wire a frame is COBS(payload + CRC-16 low byte + CRC-16 high byte) followed by a
+ * 0x00 delimiter. COBS removes every 0x00 from the frame body for 1 byte of overhead per
+ * 254 bytes, so the receiver resynchronizes on the next delimiter after any line noise.
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef FRAME_H
+#define	FRAME_H
+
+/* -------------- Includes -------------- */
+#include "../../MCAL/USART/usart.h"
+#include "../CRC16/crc16.h"
+#include "frame_cfg.h"
+
+/* -------------- Macro Declarations ------------- */
+#if EUSART_CFG_BUFFERED!=EUSART_CFG_FEATURE_ENABLE
+#error "Frame needs EUSART_CFG_BUFFERED"
+#endif
+#if (FRAME_CFG_MAX_PAYLOAD < 1) || (FRAME_CFG_MAX_PAYLOAD > 250)
+#error "FRAME_CFG_MAX_PAYLOAD must be between 1 and 250"
+#endif
+
+#define FRAME_DELIMITER             0x00U
+#define FRAME_CRC_SIZE              2U
+//Longest COBS block, a code byte of 0xFF is not followed by an implicit zero.
+#define FRAME_COBS_MAX_BLOCK        254U
+
+/* -------------- Macro Functions Declarations --------------*/
+//Bytes on the wire for a payload: COBS overhead, CRC and delimiter included.
+#define FRAME_ENCODED_SIZE(_LEN)    ((_LEN) + FRAME_CRC_SIZE + 1U + \
+                                     (((_LEN) + FRAME_CRC_SIZE) / FRAME_COBS_MAX_BLOCK) + 1U)
+
+/* -------------- Data Types Declarations --------------  */
+/**
+ * @brief Frame Statistics
+ */
+typedef struct
+{
+    uint16 rx_frames;           /* Frames received with a good CRC */
+    uint16 rx_crc_errors;       /* Frames discarded on a CRC mismatch */
+    uint16 rx_resyncs;          /* Frames discarded as malformed or too long */
+    uint16 rx_dropped;          /* Good frames lost because the previous one wasn't read */
+    uint16 tx_frames;           /* Frames queued for transmission */
+}frame_stats_t;
+
+/**
+ * @brief Frame Configurations Structure
+ */
+typedef struct
+{
+    /* Called from EUSART_RX_ISR() when a good frame is ready (can be NULL) */
+    void (* Frame_RxHandler)(void);
+}frame_t;
+
+/* -------------- Functions Declarations --------------*/
+/**
+ * @brief Initializes the framing layer and attaches the decoder to the EUSART RX stream.
+ *
+ * Eusart_Async_Init() must be called first. From now on every received byte is decoded in
+ * EUSART_RX_ISR(): COBS decoding and the CRC are updated byte by byte while the payload is
+ * written once into one of two frame buffers. A complete frame is handed over by swapping
+ * the buffers, so the next frame can be received while the application reads this one.
+ *
+ * @param _frame A pointer to the Frame Configurations Structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Frame_Init(const frame_t *_frame);
+
+/**
+ * @brief Detaches the decoder, received bytes go back to the EUSART RX ring.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Frame_DeInit(void);
+
+/**
+ * @brief Encodes a payload straight into the EUSART TX ring.
+ *
+ * The CRC is computed while the payload is scanned for COBS blocks, nothing is copied to
+ * an intermediate buffer. The frame is queued whole or not at all.
+ *
+ * @param payload The payload.
+ * @param len Payload length (1 to FRAME_CFG_MAX_PAYLOAD).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The frame was queued.
+ *         - E_NOT_OK: Invalid parameters or not enough room in the TX ring.
+ */
+Std_ReturnType Frame_Send(const uint8 *payload, uint8 len);
+
+/**
+ * @brief Retrieves the last good frame.
+ *
+ * @param payload A buffer to store the payload.
+ * @param size Size of the buffer.
+ * @param len A pointer to store the payload length.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: A frame was read.
+ *         - E_NOT_OK: No frame is waiting, the buffer is too small, or invalid parameters.
+ */
+Std_ReturnType Frame_Receive(uint8 *payload, uint8 size, uint8 *len);
+
+/**
+ * @brief Retrieves the frame statistics.
+ *
+ * @param stats A pointer to store the statistics.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Frame_Get_Stats(frame_stats_t *stats);
+
+#endif	/* FRAME_H */
@@ -0,0 +1,24 @@
+/*
+ * File:   frame_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef FRAME_CFG_H
+#define	FRAME_CFG_H
+
+/* -------------- Includes -------------- */
+
+/* -------------- Macro Declarations ------------- */
+//Largest payload of a frame in bytes (1 to 250), sizes the two receive buffers.
+#define FRAME_CFG_MAX_PAYLOAD       64U
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+
+/* -------------- Functions Declarations --------------*/
+
+
+#endif	/* FRAME_CFG_H */
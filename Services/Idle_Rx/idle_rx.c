@@ -0,0 +1,286 @@
+/*
+ * File:   idle_rx.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+#include "idle_rx.h"
+
+static void (*Idle_Rx_Handler)(const uint8 *frame, uint8 len) = NULL;
+static uint8 idle_rx_gap_chars = ZERO_INIT;
+static uint8 idle_rx_delimiter = ZERO_INIT;
+static uint8 idle_rx_delimiter_enable = ZERO_INIT;
+static timer2_t idle_rx_timer;
+static const uint8 idle_rx_prescalers[3] = {1U, 4U, 16U};   /* TIMER2_PRESCALER_DIV_x order */
+
+//Two frame buffers: EUSART_RX_ISR() fills one while the other holds the ready frame.
+static uint8 idle_rx_buffers[2][IDLE_RX_CFG_BUFFER_SIZE];
+static volatile uint8 idle_rx_active = ZERO_INIT;       /* Buffer being filled */
+static volatile uint8 idle_rx_ready_len = ZERO_INIT;    /* Length of the ready frame, 0 if none */
+//Receive state, ISR context only.
+static uint8 idle_rx_len = ZERO_INIT;
+static uint8 idle_rx_overflow = ZERO_INIT;
+static uint8 idle_rx_idle_chars = ZERO_INIT;
+static volatile idle_rx_stats_t idle_rx_stats;
+
+static void Idle_Rx_Byte(uint8 data);
+static void Idle_Rx_Char_Time(void);
+static void Idle_Rx_End_Frame(void);
+static Std_ReturnType Idle_Rx_Timer_Config(uint32 baudrate, uint8 char_bits);
+
+/**
+ * @brief Initializes the frame receiver and attaches it to the EUSART RX stream.
+ *
+ * @param _idle_rx A pointer to the Idle_Rx Configurations Structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid configuration, or the EUSART isn't initialized.
+ */
+Std_ReturnType Idle_Rx_Init(const idle_rx_t *_idle_rx)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_baudrate = ZERO_INIT;
+
+    Eusart_Get_Baudrate(&l_baudrate, NULL);
+    if(NULL == _idle_rx || ZERO_INIT == l_baudrate ||
+       (IDLE_RX_GAP_DISABLE == _idle_rx->gap_chars && ZERO_INIT == _idle_rx->delimiter_enable))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //Detach first, the receive state is reset without the ISRs running
+        ret = Eusart_Set_Rx_Byte_Handler(NULL);
+        Idle_Rx_Handler = _idle_rx->Idle_Rx_Handler;
+        idle_rx_gap_chars = _idle_rx->gap_chars;
+        idle_rx_delimiter = _idle_rx->delimiter;
+        idle_rx_delimiter_enable = _idle_rx->delimiter_enable;
+        idle_rx_active = ZERO_INIT;
+        idle_rx_ready_len = ZERO_INIT;
+        idle_rx_len = ZERO_INIT;
+        idle_rx_overflow = ZERO_INIT;
+        idle_rx_stats.rx_frames = ZERO_INIT;
+        idle_rx_stats.rx_overflows = ZERO_INIT;
+        idle_rx_stats.rx_dropped = ZERO_INIT;
+        if(IDLE_RX_GAP_DISABLE != idle_rx_gap_chars)
+        {
+            idle_rx_timer.TMR2_InterruptHandler = Idle_Rx_Char_Time;
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+            idle_rx_timer.priority = _idle_rx->priority;
+#endif
+            ret &= Idle_Rx_Timer_Config(l_baudrate, (RCSTAbits.RX9) ? 11U : 10U);
+        }else{/* Nothing */}
+        ret &= Eusart_Set_Rx_Byte_Handler(Idle_Rx_Byte);
+    }
+    return ret;
+}
+
+/**
+ * @brief Detaches the receiver and stops Timer2, bytes go back to the EUSART RX ring.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Idle_Rx_DeInit(void)
+{
+    Std_ReturnType ret = E_OK;
+
+    ret = Eusart_Set_Rx_Byte_Handler(NULL);
+    if(IDLE_RX_GAP_DISABLE != idle_rx_gap_chars)
+    {
+        ret &= Timer2_DeInit(&idle_rx_timer);
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief Retrieves the frame waiting for the application.
+ *
+ * @param frame A pointer to store the address of the frame.
+ * @param len A pointer to store the frame length.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: A frame is waiting.
+ *         - E_NOT_OK: No frame is waiting, or NULL pointers.
+ */
+Std_ReturnType Idle_Rx_Get(const uint8 **frame, uint8 *len)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_len = idle_rx_ready_len;
+
+    if(NULL == frame || NULL == len || ZERO_INIT == l_len)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //The ISRs don't swap buffers while a frame is ready
+        *frame = idle_rx_buffers[idle_rx_active ^ 1U];
+        *len = l_len;
+    }
+    return ret;
+}
+
+/**
+ * @brief Gives the frame buffer back to the receiver.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Idle_Rx_Release(void)
+{
+    Std_ReturnType ret = E_OK;
+
+    idle_rx_ready_len = ZERO_INIT;
+    return ret;
+}
+
+/**
+ * @brief Retrieves the receive statistics.
+ *
+ * @param stats A pointer to store the statistics.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Idle_Rx_Get_Stats(idle_rx_stats_t *stats)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_rx_int_status = PIE1bits.RCIE;
+    uint8 l_tmr2_int_status = PIE1bits.TMR2IE;
+
+    if(NULL == stats)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //The counters are updated by EUSART_RX_ISR() and TMR2_ISR(), copy them atomically
+        EUSART_RX_INTERRUPT_DISABLE();
+        TIMER2_INTERRUPT_DISABLE();
+        stats->rx_frames = idle_rx_stats.rx_frames;
+        stats->rx_overflows = idle_rx_stats.rx_overflows;
+        stats->rx_dropped = idle_rx_stats.rx_dropped;
+        PIE1bits.TMR2IE = l_tmr2_int_status;
+        PIE1bits.RCIE = l_rx_int_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief Stores a received byte, called by EUSART_RX_ISR() for every received byte.
+ *
+ * @param data The received byte.
+ */
+static void Idle_Rx_Byte(uint8 data)
+{
+    if(idle_rx_delimiter_enable && idle_rx_delimiter == data)
+    {
+        Idle_Rx_End_Frame();
+    }
+    else
+    {
+        if(idle_rx_len < IDLE_RX_CFG_BUFFER_SIZE)
+        {
+            idle_rx_buffers[idle_rx_active][idle_rx_len] = data;
+            idle_rx_len++;
+        }
+        else
+        {
+            idle_rx_overflow = 1;
+        }
+        if(IDLE_RX_GAP_DISABLE != idle_rx_gap_chars)
+        {
+            //Writing TMR2 also clears the prescaler and postscaler counters,
+            //the next period ends one character time after this byte
+            idle_rx_idle_chars = ZERO_INIT;
+            TMR2 = 0;
+            TIMER2_INTERRUPT_FLAG_CLEAR();
+            TIMER2_MODULE_ENABLE();
+        }else{/* Nothing */}
+    }
+}
+
+/**
+ * @brief One idle character time elapsed, called by TMR2_ISR().
+ *
+ */
+static void Idle_Rx_Char_Time(void)
+{
+    idle_rx_idle_chars++;
+    if(idle_rx_idle_chars >= idle_rx_gap_chars)
+    {
+        Idle_Rx_End_Frame();
+    }else{/* Nothing */}
+}
+
+/**
+ * @brief Hands the frame over by swapping the buffers, ISR context.
+ *
+ */
+static void Idle_Rx_End_Frame(void)
+{
+    uint8 l_ready = ZERO_INIT;
+
+    TIMER2_MODULE_DISABLE();
+    if(ZERO_INIT == idle_rx_len)
+    {
+        /* Back to back delimiters, nothing to do */
+    }
+    else if(idle_rx_overflow)
+    {
+        idle_rx_stats.rx_overflows++;
+    }
+    else if(ZERO_INIT != idle_rx_ready_len)
+    {
+        idle_rx_stats.rx_dropped++;
+    }
+    else
+    {
+        l_ready = idle_rx_active;
+        idle_rx_ready_len = idle_rx_len;
+        idle_rx_active ^= 1U;
+        idle_rx_stats.rx_frames++;
+        if(Idle_Rx_Handler)
+        {
+            Idle_Rx_Handler(idle_rx_buffers[l_ready], idle_rx_ready_len);
+        }else{/* Nothing */}
+    }
+    idle_rx_len = ZERO_INIT;
+    idle_rx_overflow = ZERO_INIT;
+}
+
+/**
+ * @brief Sets one Timer2 period to one character time, rounded up.
+ *
+ * Picks the smallest prescaler x postscaler product that keeps PR2 within 8 bits.
+ */
+static Std_ReturnType Idle_Rx_Timer_Config(uint32 baudrate, uint8 char_bits)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 l_ticks = ((_XTAL_FREQ / 4UL) * char_bits + baudrate - 1UL) / baudrate;
+    uint32 l_period = ZERO_INIT;
+    uint8 l_pre = ZERO_INIT;
+    uint8 l_post = ZERO_INIT;
+
+    for(l_pre = 0; l_pre < 3 && E_NOT_OK == ret; l_pre++)
+    {
+        for(l_post = 1; l_post <= 16 && E_NOT_OK == ret; l_post++)
+        {
+            l_period = (l_ticks + ((uint32)idle_rx_prescalers[l_pre] * l_post) - 1UL) /
+                       ((uint32)idle_rx_prescalers[l_pre] * l_post);
+            if(l_period <= 256UL)
+            {
+                idle_rx_timer.prescaler_val = l_pre;
+                idle_rx_timer.postscaler_val = (uint8)(l_post - 1U);
+                idle_rx_timer.timer2_preload = 0;
+                ret = Timer2_Init(&idle_rx_timer);
+                //Timer2 matches PR2 and restarts from 0: the period is PR2 + 1 ticks
+                PR2 = (uint8)(l_period - 1UL);
+                TIMER2_MODULE_DISABLE();
+            }else{/* Nothing */}
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,124 @@
+/*
+ * File:   idle_rx.h
+ * Author: Mohamed Sameh
+ *
+ * Variable-length frame reception over the EUSART.
+ * EUSART_RX_ISR() writes the bytes straight into one of two frame buffers. A frame ends
+ * when the line stays idle for a configured number of character times (timed by Timer2)
+ * or on a delimiter byte; the buffers are then swapped and the application gets a pointer
+ * to the frame and its length, without any copy. The next frame is received into the
+ * other buffer while the application works on this one.
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef IDLE_RX_H
+#define	IDLE_RX_H
+
+/* -------------- Includes -------------- */
+#include "../../MCAL/USART/usart.h"
+#include "../../MCAL/TIMER2/timer2.h"
+#include "idle_rx_cfg.h"
+
+/* -------------- Macro Declarations ------------- */
+#if EUSART_CFG_BUFFERED!=EUSART_CFG_FEATURE_ENABLE
+#error "Idle_Rx needs EUSART_CFG_BUFFERED"
+#endif
+#if TIMER2_INTERRUPT_ENABLE_FEATURE!=INTERRUPT_FEATURE_ENABLE
+#error "Idle_Rx needs TIMER2_INTERRUPT_ENABLE_FEATURE"
+#endif
+#if (IDLE_RX_CFG_BUFFER_SIZE < 1) || (IDLE_RX_CFG_BUFFER_SIZE > 255)
+#error "IDLE_RX_CFG_BUFFER_SIZE must be between 1 and 255"
+#endif
+
+//Gap detector off, frames end on the delimiter only.
+#define IDLE_RX_GAP_DISABLE         0U
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+/**
+ * @brief Idle_Rx Statistics
+ */
+typedef struct
+{
+    uint16 rx_frames;           /* Frames handed to the application */
+    uint16 rx_overflows;        /* Frames longer than IDLE_RX_CFG_BUFFER_SIZE, discarded */
+    uint16 rx_dropped;          /* Frames lost because the previous one wasn't released */
+}idle_rx_stats_t;
+
+/**
+ * @brief Idle_Rx Configurations Structure
+ */
+typedef struct
+{
+    uint8 gap_chars;                /* Idle character times ending a frame, or IDLE_RX_GAP_DISABLE */
+    uint8 delimiter;                /* Byte ending a frame, not stored */
+    uint8 delimiter_enable : 1;
+    uint8 idle_rx_reserved : 7;
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+    interrupt_priority priority;    /* Timer2 priority, use the priority of the EUSART RX interrupt */
+#endif
+    /* Called from the ISRs with a complete frame (can be NULL) */
+    void (* Idle_Rx_Handler)(const uint8 *frame, uint8 len);
+}idle_rx_t;
+
+/* -------------- Functions Declarations --------------*/
+/**
+ * @brief Initializes the frame receiver and attaches it to the EUSART RX stream.
+ *
+ * Eusart_Async_Init() must be called first: one Timer2 period is set to one character
+ * time at the achieved baud rate (10 bits, 11 in 9-bit mode). Timer2 belongs to the
+ * receiver and only runs while a frame is being received.
+ *
+ * @param _idle_rx A pointer to the Idle_Rx Configurations Structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid configuration, or the EUSART isn't initialized.
+ */
+Std_ReturnType Idle_Rx_Init(const idle_rx_t *_idle_rx);
+
+/**
+ * @brief Detaches the receiver and stops Timer2, bytes go back to the EUSART RX ring.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Idle_Rx_DeInit(void);
+
+/**
+ * @brief Retrieves the frame waiting for the application.
+ *
+ * The frame stays valid until Idle_Rx_Release(), no further frame is handed over before.
+ *
+ * @param frame A pointer to store the address of the frame.
+ * @param len A pointer to store the frame length.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: A frame is waiting.
+ *         - E_NOT_OK: No frame is waiting, or NULL pointers.
+ */
+Std_ReturnType Idle_Rx_Get(const uint8 **frame, uint8 *len);
+
+/**
+ * @brief Gives the frame buffer back to the receiver.
+ *
+ * Can be called from Idle_Rx_Handler when the frame was handled there.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Idle_Rx_Release(void);
+
+/**
+ * @brief Retrieves the receive statistics.
+ *
+ * @param stats A pointer to store the statistics.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Idle_Rx_Get_Stats(idle_rx_stats_t *stats);
+
+#endif	/* IDLE_RX_H */
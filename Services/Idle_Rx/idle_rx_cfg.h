@@ -0,0 +1,24 @@
+/*
+ * File:   idle_rx_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef IDLE_RX_CFG_H
+#define	IDLE_RX_CFG_H
+
+/* -------------- Includes -------------- */
+
+/* -------------- Macro Declarations ------------- */
+//Largest frame in bytes (1 to 255), sizes each of the two receive buffers.
+#define IDLE_RX_CFG_BUFFER_SIZE     64U
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+
+/* -------------- Functions Declarations --------------*/
+
+
+#endif	/* IDLE_RX_CFG_H */
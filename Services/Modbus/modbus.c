@@ -0,0 +1,611 @@
+/*
+ * File:   modbus.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+#include "modbus.h"
+
+/**
+ * @brief Receive State, shared by EUSART_RX_ISR(), TMR0_ISR() and Modbus_Tasks()
+ */
+typedef enum
+{
+    MODBUS_RX_IDLE = 0,             /* Waiting for the first byte of a request */
+    MODBUS_RX_RECEIVING,            /* Bytes arriving, Timer0 times the silence */
+    MODBUS_RX_FRAME_READY           /* Request owned by Modbus_Tasks(), Timer0 times the latency */
+}modbus_rx_state_t;
+
+static void (*Modbus_WriteHandler)(uint16 address, uint16 count) = NULL;
+static uint8 modbus_slave_address = ZERO_INIT;
+static timer0_t modbus_timer;
+static uint16 modbus_silence_preload = ZERO_INIT;
+
+//Request, written by EUSART_RX_ISR() until the frame is handed to Modbus_Tasks().
+static uint8 modbus_rx_buffer[MODBUS_CFG_MAX_ADU];
+static volatile uint8 modbus_rx_len = ZERO_INIT;
+static volatile uint16 modbus_rx_crc = CRC16_INIT_VALUE;
+static volatile uint8 modbus_rx_overflow = ZERO_INIT;
+static volatile modbus_rx_state_t modbus_rx_state = MODBUS_RX_IDLE;
+static volatile uint8 modbus_latency_overflow = ZERO_INIT;
+static volatile modbus_stats_t modbus_stats;
+
+//Response, Modbus_Tasks() context only.
+static uint8 modbus_tx_buffer[MODBUS_CFG_MAX_ADU];
+static uint8 modbus_tx_len = ZERO_INIT;
+static uint8 modbus_request_handled = ZERO_INIT;
+static uint16 modbus_write_address = ZERO_INIT;
+static uint16 modbus_write_count = ZERO_INIT;
+
+//Register table.
+static uint16 modbus_holding_registers[MODBUS_CFG_HOLDING_REGISTERS];
+static uint16 modbus_eeprom_registers[MODBUS_CFG_EEPROM_REGISTERS];
+static uint16 modbus_input_registers[MODBUS_CFG_INPUT_REGISTERS];
+//EEPROM write-back: one dirty bit per EEPROM register.
+static uint16 modbus_eeprom_dirty = ZERO_INIT;
+static uint8 modbus_eeprom_index = ZERO_INIT;
+static uint8 modbus_eeprom_low_byte = ZERO_INIT;
+static uint16 modbus_eeprom_value = ZERO_INIT;
+
+static void Modbus_Rx_Byte(uint8 data);
+static void Modbus_Timer_Elapsed(void);
+static inline void Modbus_Rx_Reset(void);
+static uint16 Modbus_Silence_Ticks(uint32 baudrate);
+static uint8 Modbus_Process(const uint8 *request, uint8 len, uint8 *response);
+static uint16 Modbus_Read_Register(uint8 function, uint16 address);
+static void Modbus_EEPROM_Tasks(void);
+
+/**
+ * @brief Initializes the slave and attaches it to the EUSART RX stream.
+ *
+ * @param _modbus A pointer to the Modbus Configurations Structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid configuration or the EUSART isn't initialized.
+ */
+Std_ReturnType Modbus_Init(const modbus_t *_modbus)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_baudrate = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_high = ZERO_INIT;
+    uint8 l_low = ZERO_INIT;
+
+    Eusart_Get_Baudrate(&l_baudrate, NULL);
+    if(NULL == _modbus || MODBUS_BROADCAST_ADDRESS == _modbus->slave_address ||
+       _modbus->slave_address > 247 || ZERO_INIT == l_baudrate)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //Detach first, the receive state is reset without the ISRs running
+        ret = Eusart_Set_Rx_Byte_Handler(NULL);
+        modbus_slave_address = _modbus->slave_address;
+        Modbus_WriteHandler = _modbus->Modbus_WriteHandler;
+        Modbus_Rx_Reset();
+        modbus_rx_state = MODBUS_RX_IDLE;
+        modbus_tx_len = ZERO_INIT;
+        modbus_request_handled = ZERO_INIT;
+        modbus_stats.rx_frames = ZERO_INIT;
+        modbus_stats.rx_crc_errors = ZERO_INIT;
+        modbus_stats.rx_dropped = ZERO_INIT;
+        modbus_stats.exceptions = ZERO_INIT;
+        modbus_stats.latency_last = ZERO_INIT;
+        modbus_stats.latency_max = ZERO_INIT;
+        //Load the persistent registers
+        for(l_index = 0; l_index < MODBUS_CFG_EEPROM_REGISTERS; l_index++)
+        {
+            ret &= EEPROM_ReadByte(MODBUS_CFG_EEPROM_BASE + (2U * l_index), &l_high);
+            ret &= EEPROM_ReadByte(MODBUS_CFG_EEPROM_BASE + (2U * l_index) + 1U, &l_low);
+            modbus_eeprom_registers[l_index] = (uint16)(((uint16)l_high << 8) | l_low);
+        }
+        modbus_eeprom_dirty = ZERO_INIT;
+        modbus_eeprom_low_byte = ZERO_INIT;
+        //Timer0 overflows after the 3.5 character silence, it only runs while receiving
+        modbus_silence_preload = (uint16)(0x10000UL - Modbus_Silence_Ticks(l_baudrate));
+        modbus_timer.TMR0_InterruptHandler = Modbus_Timer_Elapsed;
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+        modbus_timer.priority = _modbus->priority;
+#endif
+        modbus_timer.timer0_preload = modbus_silence_preload;
+        modbus_timer.prescaler_status = TIMER0_PRESCALER_ENABLE_CFG;
+        modbus_timer.prescaler_val = TIMER0_PRESCALER_DIV_8;
+        modbus_timer.timer0_mode = TIMER0_TIMER_MODE;
+        modbus_timer.timer0_reg_size = TIMER0_16BIT_REGISTER_MODE;
+        modbus_timer.timer0_counter_edge = TIMER0_RISING_EDGE_CFG;
+        ret &= Timer0_Init(&modbus_timer);
+        TIMER0_MODULE_DISABLE();
+        ret &= Eusart_Set_Rx_Byte_Handler(Modbus_Rx_Byte);
+    }
+    return ret;
+}
+
+/**
+ * @brief Detaches the slave from the EUSART and stops Timer0.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Modbus_DeInit(void)
+{
+    Std_ReturnType ret = E_OK;
+
+    ret = Eusart_Set_Rx_Byte_Handler(NULL);
+    ret &= Timer0_DeInit(&modbus_timer);
+    return ret;
+}
+
+/**
+ * @brief Answers a pending request and writes changed EEPROM registers back.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Modbus_Tasks(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_crc = CRC16_INIT_VALUE;
+    uint16 l_latency = ZERO_INIT;
+
+    if(MODBUS_RX_FRAME_READY == modbus_rx_state)
+    {
+        if(ZERO_INIT == modbus_request_handled)
+        {
+            //The request stays in place, EUSART_RX_ISR() drops bytes until it is released
+            modbus_tx_len = Modbus_Process(modbus_rx_buffer, modbus_rx_len, modbus_tx_buffer);
+            if(MODBUS_BROADCAST_ADDRESS == modbus_rx_buffer[0])
+            {
+                modbus_tx_len = ZERO_INIT;
+            }
+            else if(modbus_tx_len)
+            {
+                ret = CRC16_Calculate(modbus_tx_buffer, modbus_tx_len, &l_crc);
+                modbus_tx_buffer[modbus_tx_len] = (uint8)(l_crc);
+                modbus_tx_buffer[modbus_tx_len + 1] = (uint8)(l_crc >> 8);
+                modbus_tx_len = (uint8)(modbus_tx_len + 2U);
+            }else{/* Nothing */}
+            modbus_request_handled = 1;
+        }else{/* Nothing */}
+
+        //All or nothing, retried on the next call while the TX ring is busy
+        if(ZERO_INIT == modbus_tx_len || E_OK == Eusart_Write(modbus_tx_buffer, modbus_tx_len))
+        {
+            //Latency: Timer0 counts from the end of the request silence
+            ret &= Timer0_Read(&modbus_timer, &l_latency);
+            TIMER0_MODULE_DISABLE();
+            if(modbus_latency_overflow)
+            {
+                l_latency = 0xFFFF;
+            }else{/* Nothing */}
+            modbus_stats.latency_last = l_latency;
+            if(l_latency > modbus_stats.latency_max)
+            {
+                modbus_stats.latency_max = l_latency;
+            }else{/* Nothing */}
+            //Release the request buffer, the next byte starts a new frame
+            modbus_request_handled = ZERO_INIT;
+            Modbus_Rx_Reset();
+            modbus_rx_state = MODBUS_RX_IDLE;
+            if(modbus_write_count && Modbus_WriteHandler)
+            {
+                Modbus_WriteHandler(modbus_write_address, modbus_write_count);
+            }else{/* Nothing */}
+            modbus_write_count = ZERO_INIT;
+        }else{/* Nothing */}
+    }else{/* Nothing */}
+    Modbus_EEPROM_Tasks();
+    return ret;
+}
+
+/**
+ * @brief Reads a holding register.
+ *
+ * @param address The register address.
+ * @param value A pointer to store the value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid address or NULL pointer.
+ */
+Std_ReturnType Modbus_Get_Holding_Register(uint16 address, uint16 *value)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == value || address >= MODBUS_TOTAL_HOLDING_REGISTERS)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *value = Modbus_Read_Register(MODBUS_FC_READ_HOLDING, address);
+    }
+    return ret;
+}
+
+/**
+ * @brief Writes a holding register, EEPROM registers are persisted by Modbus_Tasks().
+ *
+ * @param address The register address.
+ * @param value The value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid address.
+ */
+Std_ReturnType Modbus_Set_Holding_Register(uint16 address, uint16 value)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(address < MODBUS_CFG_HOLDING_REGISTERS)
+    {
+        modbus_holding_registers[address] = value;
+    }
+    else if(address < MODBUS_TOTAL_HOLDING_REGISTERS)
+    {
+        address -= MODBUS_CFG_HOLDING_REGISTERS;
+        modbus_eeprom_registers[address] = value;
+        modbus_eeprom_dirty |= (uint16)(1U << address);
+    }
+    else
+    {
+        ret = E_NOT_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Updates an input register.
+ *
+ * @param address The register address.
+ * @param value The value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid address.
+ */
+Std_ReturnType Modbus_Set_Input_Register(uint16 address, uint16 value)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(address >= MODBUS_CFG_INPUT_REGISTERS)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        modbus_input_registers[address] = value;
+    }
+    return ret;
+}
+
+/**
+ * @brief Retrieves the slave statistics.
+ *
+ * @param stats A pointer to store the statistics.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Modbus_Get_Stats(modbus_stats_t *stats)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_rx_int_status = PIE1bits.RCIE;
+    uint8 l_tmr0_int_status = INTCONbits.TMR0IE;
+
+    if(NULL == stats)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //The counters are updated by EUSART_RX_ISR() and TMR0_ISR(), copy them atomically
+        EUSART_RX_INTERRUPT_DISABLE();
+        TIMER0_INTERRUPT_DISABLE();
+        stats->rx_frames = modbus_stats.rx_frames;
+        stats->rx_crc_errors = modbus_stats.rx_crc_errors;
+        stats->rx_dropped = modbus_stats.rx_dropped;
+        stats->exceptions = modbus_stats.exceptions;
+        stats->latency_last = modbus_stats.latency_last;
+        stats->latency_max = modbus_stats.latency_max;
+        INTCONbits.TMR0IE = l_tmr0_int_status;
+        PIE1bits.RCIE = l_rx_int_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief Collects a request byte, called by EUSART_RX_ISR() for every received byte.
+ *
+ * @param data The received byte.
+ */
+static void Modbus_Rx_Byte(uint8 data)
+{
+    if(MODBUS_RX_FRAME_READY == modbus_rx_state)
+    {
+        //The master must wait for the answer
+        modbus_stats.rx_dropped++;
+    }
+    else
+    {
+        if(modbus_rx_len < MODBUS_CFG_MAX_ADU)
+        {
+            modbus_rx_buffer[modbus_rx_len] = data;
+            modbus_rx_len++;
+            modbus_rx_crc = CRC16_Update(modbus_rx_crc, data);
+        }
+        else
+        {
+            modbus_rx_overflow = 1;
+            modbus_stats.rx_dropped++;
+        }
+        modbus_rx_state = MODBUS_RX_RECEIVING;
+        //Restart the silence timer
+        TMR0H = (uint8)(modbus_silence_preload >> 8);
+        TMR0L = (uint8)(modbus_silence_preload);
+        TIMER0_INTERRUPT_FLAG_CLEAR();
+        TIMER0_MODULE_ENABLE();
+    }
+}
+
+/**
+ * @brief Timer0 overflow, called by TMR0_ISR().
+ *
+ * While receiving, the line has been silent for 3.5 characters: the frame is complete.
+ * While a request is pending, the latency count overflowed.
+ */
+static void Modbus_Timer_Elapsed(void)
+{
+    if(MODBUS_RX_RECEIVING == modbus_rx_state)
+    {
+        if(modbus_rx_overflow || modbus_rx_len < MODBUS_MIN_ADU)
+        {
+            /* Counted as dropped bytes or too short to be a request */
+            TIMER0_MODULE_DISABLE();
+            Modbus_Rx_Reset();
+            modbus_rx_state = MODBUS_RX_IDLE;
+        }
+        else if(CRC16_GOOD_RESIDUE != modbus_rx_crc)
+        {
+            modbus_stats.rx_crc_errors++;
+            TIMER0_MODULE_DISABLE();
+            Modbus_Rx_Reset();
+            modbus_rx_state = MODBUS_RX_IDLE;
+        }
+        else if(modbus_slave_address != modbus_rx_buffer[0] &&
+                MODBUS_BROADCAST_ADDRESS != modbus_rx_buffer[0])
+        {
+            //Addressed to another slave
+            TIMER0_MODULE_DISABLE();
+            Modbus_Rx_Reset();
+            modbus_rx_state = MODBUS_RX_IDLE;
+        }
+        else
+        {
+            //Hand the request over and start counting the latency from here
+            modbus_stats.rx_frames++;
+            modbus_latency_overflow = ZERO_INIT;
+            TMR0H = 0;
+            TMR0L = 0;
+            modbus_rx_state = MODBUS_RX_FRAME_READY;
+        }
+    }
+    else if(MODBUS_RX_FRAME_READY == modbus_rx_state)
+    {
+        modbus_latency_overflow = 1;
+        TIMER0_MODULE_DISABLE();
+    }
+    else
+    {
+        TIMER0_MODULE_DISABLE();
+    }
+}
+
+/**
+ * @brief Prepares the receiver for the next request.
+ *
+ */
+static inline void Modbus_Rx_Reset(void)
+{
+    modbus_rx_len = ZERO_INIT;
+    modbus_rx_crc = CRC16_INIT_VALUE;
+    modbus_rx_overflow = ZERO_INIT;
+}
+
+/**
+ * @brief Converts the 3.5 character silence to Timer0 ticks, rounded up.
+ *
+ */
+static uint16 Modbus_Silence_Ticks(uint32 baudrate)
+{
+    uint32 l_ticks = ZERO_INIT;
+
+    if(baudrate > MODBUS_FIXED_SILENCE_BAUDRATE)
+    {
+        l_ticks = (MODBUS_FIXED_SILENCE_US * MODBUS_TIMER_TICKS_PER_MS + 999UL) / 1000UL;
+    }
+    else
+    {
+        //3.5 characters of 11 bits: 38.5 / baudrate seconds
+        l_ticks = (77UL * MODBUS_TIMER_TICKS_PER_MS * 1000UL + (2UL * baudrate) - 1UL) / (2UL * baudrate);
+    }
+    if(l_ticks > 0xFFFFUL)
+    {
+        l_ticks = 0xFFFFUL;
+    }else{/* Nothing */}
+    return (uint16)l_ticks;
+}
+
+/**
+ * @brief Executes a request and builds the response without its CRC.
+ *
+ * @return uint8 Response length, 0 if there is nothing to send.
+ */
+static uint8 Modbus_Process(const uint8 *request, uint8 len, uint8 *response)
+{
+    uint8 l_function = request[1];
+    uint16 l_address = (uint16)(((uint16)request[2] << 8) | request[3]);
+    uint16 l_count = (uint16)(((uint16)request[4] << 8) | request[5]);
+    uint16 l_limit = ZERO_INIT;
+    uint16 l_value = ZERO_INIT;
+    uint8 l_exception = ZERO_INIT;
+    uint8 l_len = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+
+    response[0] = request[0];
+    response[1] = l_function;
+    switch(l_function)
+    {
+        case MODBUS_FC_READ_HOLDING:
+        case MODBUS_FC_READ_INPUT:
+            l_limit = (MODBUS_FC_READ_HOLDING == l_function) ? MODBUS_TOTAL_HOLDING_REGISTERS :
+                                                              MODBUS_CFG_INPUT_REGISTERS;
+            if(8U != len || ZERO_INIT == l_count || l_count > MODBUS_MAX_READ_REGISTERS)
+            {
+                l_exception = MODBUS_EX_ILLEGAL_VALUE;
+            }
+            else if(((uint32)l_address + l_count) > l_limit)
+            {
+                l_exception = MODBUS_EX_ILLEGAL_ADDRESS;
+            }
+            else
+            {
+                response[2] = (uint8)(2U * l_count);
+                for(l_index = 0; l_index < l_count; l_index++)
+                {
+                    l_value = Modbus_Read_Register(l_function, l_address + l_index);
+                    response[3 + (2U * l_index)] = (uint8)(l_value >> 8);
+                    response[4 + (2U * l_index)] = (uint8)(l_value);
+                }
+                l_len = (uint8)(3U + (2U * l_count));
+            }
+            break;
+        case MODBUS_FC_WRITE_SINGLE:
+            if(8U != len)
+            {
+                l_exception = MODBUS_EX_ILLEGAL_VALUE;
+            }
+            else if(l_address >= MODBUS_TOTAL_HOLDING_REGISTERS)
+            {
+                l_exception = MODBUS_EX_ILLEGAL_ADDRESS;
+            }
+            else
+            {
+                //The value sits where the count of the other functions is
+                Modbus_Set_Holding_Register(l_address, l_count);
+                modbus_write_address = l_address;
+                modbus_write_count = 1;
+                //The response echoes the request
+                for(l_index = 2; l_index < 6; l_index++)
+                {
+                    response[l_index] = request[l_index];
+                }
+                l_len = 6;
+            }
+            break;
+        case MODBUS_FC_WRITE_MULTIPLE:
+            if(len < 9U || ZERO_INIT == l_count || l_count > MODBUS_MAX_WRITE_REGISTERS ||
+               request[6] != (uint8)(2U * l_count) || len != (uint8)(9U + request[6]))
+            {
+                l_exception = MODBUS_EX_ILLEGAL_VALUE;
+            }
+            else if(((uint32)l_address + l_count) > MODBUS_TOTAL_HOLDING_REGISTERS)
+            {
+                l_exception = MODBUS_EX_ILLEGAL_ADDRESS;
+            }
+            else
+            {
+                //The whole range was checked first, a request is applied whole or not at all
+                for(l_index = 0; l_index < l_count; l_index++)
+                {
+                    l_value = (uint16)(((uint16)request[7 + (2U * l_index)] << 8) | request[8 + (2U * l_index)]);
+                    Modbus_Set_Holding_Register(l_address + l_index, l_value);
+                }
+                modbus_write_address = l_address;
+                modbus_write_count = l_count;
+                for(l_index = 2; l_index < 6; l_index++)
+                {
+                    response[l_index] = request[l_index];
+                }
+                l_len = 6;
+            }
+            break;
+        default:
+            l_exception = MODBUS_EX_ILLEGAL_FUNCTION;
+            break;
+    }
+    if(l_exception)
+    {
+        response[1] = (uint8)(l_function | 0x80U);
+        response[2] = l_exception;
+        l_len = 3;
+        modbus_stats.exceptions++;
+    }else{/* Nothing */}
+    return l_len;
+}
+
+/**
+ * @brief Reads a register of the table, the address must be valid.
+ *
+ */
+static uint16 Modbus_Read_Register(uint8 function, uint16 address)
+{
+    uint16 l_value = ZERO_INIT;
+
+    if(MODBUS_FC_READ_INPUT == function)
+    {
+        l_value = modbus_input_registers[address];
+    }
+    else if(address < MODBUS_CFG_HOLDING_REGISTERS)
+    {
+        l_value = modbus_holding_registers[address];
+    }
+    else
+    {
+        l_value = modbus_eeprom_registers[address - MODBUS_CFG_HOLDING_REGISTERS];
+    }
+    return l_value;
+}
+
+/**
+ * @brief Writes the next changed EEPROM byte back, at most one write cycle per call.
+ *
+ */
+static void Modbus_EEPROM_Tasks(void)
+{
+    uint8 l_busy = ZERO_INIT;
+    uint8 l_stored = ZERO_INIT;
+    uint8 l_data = ZERO_INIT;
+    uint16 l_ee_address = ZERO_INIT;
+
+    EEPROM_Write_Busy(&l_busy);
+    if(l_busy || (ZERO_INIT == modbus_eeprom_dirty && ZERO_INIT == modbus_eeprom_low_byte))
+    {
+        /* Nothing to do now */
+    }
+    else
+    {
+        if(ZERO_INIT == modbus_eeprom_low_byte)
+        {
+            //Next dirty register, both bytes are written from the same snapshot
+            while(ZERO_INIT == (modbus_eeprom_dirty & (uint16)(1U << modbus_eeprom_index)))
+            {
+                modbus_eeprom_index = (uint8)((modbus_eeprom_index + 1U) % MODBUS_CFG_EEPROM_REGISTERS);
+            }
+            modbus_eeprom_dirty &= (uint16)~(1U << modbus_eeprom_index);
+            modbus_eeprom_value = modbus_eeprom_registers[modbus_eeprom_index];
+            l_data = (uint8)(modbus_eeprom_value >> 8);
+        }
+        else
+        {
+            l_data = (uint8)(modbus_eeprom_value);
+        }
+        l_ee_address = MODBUS_CFG_EEPROM_BASE + (2U * modbus_eeprom_index) + modbus_eeprom_low_byte;
+        //Skip bytes that already hold the value, saves time and endurance
+        EEPROM_ReadByte(l_ee_address, &l_stored);
+        if(l_stored != l_data)
+        {
+            EEPROM_WriteByte_Start(l_ee_address, l_data);
+        }else{/* Nothing */}
+        modbus_eeprom_low_byte ^= 1U;
+    }
+}
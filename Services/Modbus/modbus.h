@@ -0,0 +1,182 @@
+/*
+ * File:   modbus.h
+ * Author: Mohamed Sameh
+ *
+ * Modbus RTU slave on the EUSART.
+ * Bytes are collected and CRC checked one by one in EUSART_RX_ISR(), Timer0 detects the
+ * 3.5 character silence that ends a frame, and Modbus_Tasks() answers from the main loop
+ * without blocking. Supported functions: 03 Read Holding Registers, 04 Read Input
+ * Registers, 06 Write Single Register and 16 Write Multiple Registers.
+ *
+ * Timer0 runs at Fosc/32 (MODBUS_TIMER_TICKS_PER_MS ticks per ms) and belongs to the stack.
+ * After the silence it keeps counting, so the stack measures its own response latency:
+ * the time from the end of the request to the response being queued for transmission.
+ * That latency is bounded by the Modbus_Tasks() call period plus the handling of one
+ * request, and is reported by Modbus_Get_Stats().
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef MODBUS_H
+#define	MODBUS_H
+
+/* -------------- Includes -------------- */
+#include "../../MCAL/USART/usart.h"
+#include "../../MCAL/TIMER0/timer0.h"
+#include "../../MCAL/EEPROM/eeprom.h"
+#include "../CRC16/crc16.h"
+#include "modbus_cfg.h"
+
+/* -------------- Macro Declarations ------------- */
+#if EUSART_CFG_BUFFERED!=EUSART_CFG_FEATURE_ENABLE
+#error "Modbus needs EUSART_CFG_BUFFERED"
+#endif
+#if TIMER0_INTERRUPT_ENABLE_FEATURE!=INTERRUPT_FEATURE_ENABLE
+#error "Modbus needs TIMER0_INTERRUPT_ENABLE_FEATURE"
+#endif
+#if (MODBUS_CFG_MAX_ADU < 16) || (MODBUS_CFG_MAX_ADU > EUSART_CFG_TX_BUFFER_SIZE)
+#error "MODBUS_CFG_MAX_ADU must be between 16 and EUSART_CFG_TX_BUFFER_SIZE"
+#endif
+#if (MODBUS_CFG_EEPROM_REGISTERS < 1) || (MODBUS_CFG_EEPROM_REGISTERS > 16)
+#error "MODBUS_CFG_EEPROM_REGISTERS must be between 1 and 16"
+#endif
+#if (MODBUS_CFG_HOLDING_REGISTERS < 1) || (MODBUS_CFG_INPUT_REGISTERS < 1)
+#error "Modbus needs at least one RAM holding register and one input register"
+#endif
+
+#define MODBUS_BROADCAST_ADDRESS        0U
+//Smallest valid request: address, function code, 2 data bytes and the CRC.
+#define MODBUS_MIN_ADU                  6U
+
+//Function Codes
+#define MODBUS_FC_READ_HOLDING          0x03U
+#define MODBUS_FC_READ_INPUT            0x04U
+#define MODBUS_FC_WRITE_SINGLE          0x06U
+#define MODBUS_FC_WRITE_MULTIPLE        0x10U
+
+//Exception Codes
+#define MODBUS_EX_ILLEGAL_FUNCTION      0x01U
+#define MODBUS_EX_ILLEGAL_ADDRESS       0x02U
+#define MODBUS_EX_ILLEGAL_VALUE         0x03U
+
+#define MODBUS_TOTAL_HOLDING_REGISTERS  (MODBUS_CFG_HOLDING_REGISTERS + MODBUS_CFG_EEPROM_REGISTERS)
+//Register counts that fit in MODBUS_CFG_MAX_ADU.
+#define MODBUS_MAX_READ_REGISTERS       ((MODBUS_CFG_MAX_ADU - 5U) / 2U)
+#define MODBUS_MAX_WRITE_REGISTERS      ((MODBUS_CFG_MAX_ADU - 9U) / 2U)
+
+//Timer0 runs from Fosc/4 with a 1:8 prescaler.
+#define MODBUS_TIMER_TICKS_PER_MS       ((_XTAL_FREQ) / 32000UL)
+//Above 19200 bit/s the silence is fixed to 1750 us.
+#define MODBUS_FIXED_SILENCE_BAUDRATE   19200UL
+#define MODBUS_FIXED_SILENCE_US         1750UL
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+/**
+ * @brief Modbus Statistics
+ */
+typedef struct
+{
+    uint16 rx_frames;           /* Requests addressed to this slave with a good CRC */
+    uint16 rx_crc_errors;       /* Frames discarded on a CRC mismatch */
+    uint16 rx_dropped;          /* Bytes lost: frame too long, or received before the answer */
+    uint16 exceptions;          /* Exception responses sent */
+    uint16 latency_last;        /* Response latency of the last request, in Timer0 ticks */
+    uint16 latency_max;         /* Worst response latency, 0xFFFF if Timer0 overflowed */
+}modbus_stats_t;
+
+/**
+ * @brief Modbus Configurations Structure
+ */
+typedef struct
+{
+    uint8 slave_address;        /* 1 to 247 */
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+    interrupt_priority priority;    /* Timer0 priority, use the priority of the EUSART RX interrupt */
+#endif
+    /* Called from Modbus_Tasks() after a master wrote holding registers (can be NULL) */
+    void (* Modbus_WriteHandler)(uint16 address, uint16 count);
+}modbus_t;
+
+/* -------------- Functions Declarations --------------*/
+/**
+ * @brief Initializes the slave and attaches it to the EUSART RX stream.
+ *
+ * Eusart_Async_Init() must be called first, the silence time is derived from the
+ * achieved baud rate. Timer0 is configured by the stack. The EEPROM registers are loaded
+ * from the internal EEPROM.
+ *
+ * @param _modbus A pointer to the Modbus Configurations Structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid configuration or the EUSART isn't initialized.
+ */
+Std_ReturnType Modbus_Init(const modbus_t *_modbus);
+
+/**
+ * @brief Detaches the slave from the EUSART and stops Timer0.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Modbus_DeInit(void);
+
+/**
+ * @brief Answers a pending request and writes changed EEPROM registers back.
+ *
+ * Call it from the main loop, it never waits: a response that doesn't fit the TX ring is
+ * retried on the next call, and EEPROM registers are written one byte per call while the
+ * EEPROM is idle (bytes that didn't change are skipped).
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Modbus_Tasks(void);
+
+/**
+ * @brief Reads a holding register.
+ *
+ * @param address The register address.
+ * @param value A pointer to store the value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid address or NULL pointer.
+ */
+Std_ReturnType Modbus_Get_Holding_Register(uint16 address, uint16 *value);
+
+/**
+ * @brief Writes a holding register, EEPROM registers are persisted by Modbus_Tasks().
+ *
+ * @param address The register address.
+ * @param value The value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid address.
+ */
+Std_ReturnType Modbus_Set_Holding_Register(uint16 address, uint16 value);
+
+/**
+ * @brief Updates an input register.
+ *
+ * @param address The register address.
+ * @param value The value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid address.
+ */
+Std_ReturnType Modbus_Set_Input_Register(uint16 address, uint16 value);
+
+/**
+ * @brief Retrieves the slave statistics.
+ *
+ * @param stats A pointer to store the statistics.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Modbus_Get_Stats(modbus_stats_t *stats);
+
+#endif	/* MODBUS_H */
@@ -0,0 +1,33 @@
+/*
+ * File:   modbus_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef MODBUS_CFG_H
+#define	MODBUS_CFG_H
+
+/* -------------- Includes -------------- */
+
+/* -------------- Macro Declarations ------------- */
+//Largest request or response in bytes (address to CRC), at most EUSART_CFG_TX_BUFFER_SIZE.
+#define MODBUS_CFG_MAX_ADU              64U
+
+//Register table: holding registers 0 to MODBUS_CFG_HOLDING_REGISTERS - 1 live in RAM, the
+//next MODBUS_CFG_EEPROM_REGISTERS (1 to 16) holding registers are kept in the internal EEPROM.
+#define MODBUS_CFG_HOLDING_REGISTERS    16U
+#define MODBUS_CFG_EEPROM_REGISTERS     8U
+#define MODBUS_CFG_INPUT_REGISTERS      8U
+
+//EEPROM address of the first persistent register, 2 bytes per register (high byte first).
+#define MODBUS_CFG_EEPROM_BASE          0x0000U
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+
+/* -------------- Functions Declarations --------------*/
+
+
+#endif	/* MODBUS_CFG_H */
@@ -0,0 +1,600 @@
+/*
+ * File:   shell.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+#include "shell.h"
+
+/**
+ * @brief Multi-line outputs, produced one line per Shell_Tasks() call
+ */
+typedef enum
+{
+    SHELL_JOB_NONE = 0,
+    SHELL_JOB_HELP,
+    SHELL_JOB_PEEK,
+    SHELL_JOB_EERD,
+    SHELL_JOB_STATS
+}shell_job_t;
+
+static Std_ReturnType Shell_Cmd_Help(uint8 argc, char *argv[]);
+static Std_ReturnType Shell_Cmd_Peek(uint8 argc, char *argv[]);
+static Std_ReturnType Shell_Cmd_Poke(uint8 argc, char *argv[]);
+static Std_ReturnType Shell_Cmd_Eerd(uint8 argc, char *argv[]);
+static Std_ReturnType Shell_Cmd_Eewr(uint8 argc, char *argv[]);
+static Std_ReturnType Shell_Cmd_Stats(uint8 argc, char *argv[]);
+static void Shell_PutChar(void *context, uint8 data);
+static void Shell_Input(uint8 data);
+static void Shell_Execute(void);
+static uint8 Shell_Tokenize(char *line, char *argv[]);
+static const shell_command_t *Shell_Find(const char *name);
+static const shell_command_t *Shell_Command_At(uint8 index);
+static void Shell_Job_Step(void);
+static Std_ReturnType Shell_Parse_Range(uint8 argc, char *argv[], uint16 end);
+static uint8 Shell_Peek_Allowed(uint16 address);
+
+static const shell_command_t shell_builtins[] =
+{
+    {"help",  "",                   Shell_Cmd_Help},
+    {"peek",  "<address> [count]",  Shell_Cmd_Peek},
+    {"poke",  "<address> <value>",  Shell_Cmd_Poke},
+    {"eerd",  "<address> [count]",  Shell_Cmd_Eerd},
+    {"eewr",  "<address> <value>",  Shell_Cmd_Eewr},
+    {"stats", "",                   Shell_Cmd_Stats}
+};
+#define SHELL_BUILTIN_COUNT     ((uint8)(sizeof(shell_builtins) / sizeof(shell_builtins[0])))
+
+static const format_sink_t shell_sink = {Shell_PutChar, NULL};
+static const shell_command_t *shell_commands = NULL;
+static uint8 shell_command_count = ZERO_INIT;
+static uint8 shell_initialized = ZERO_INIT;
+
+//Line being typed, split into words in place once complete.
+static char shell_line[SHELL_CFG_LINE_SIZE + 1];
+static uint8 shell_line_len = ZERO_INIT;
+static uint8 shell_line_ready = ZERO_INIT;
+static uint8 shell_last_cr = ZERO_INIT;
+
+static shell_job_t shell_job = SHELL_JOB_NONE;
+static uint16 shell_job_address = ZERO_INIT;
+static uint16 shell_job_remaining = ZERO_INIT;
+
+/**
+ * @brief Initializes the shell and prints the prompt.
+ *
+ * @param _shell A pointer to the Shell Configurations Structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Shell_Init(const shell_t *_shell)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == _shell || (NULL == _shell->commands && ZERO_INIT != _shell->command_count))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        shell_commands = _shell->commands;
+        shell_command_count = _shell->command_count;
+        shell_line_len = ZERO_INIT;
+        shell_line_ready = ZERO_INIT;
+        shell_last_cr = ZERO_INIT;
+        shell_job = SHELL_JOB_NONE;
+        shell_initialized = 1;
+        ret = Shell_Print("\r\n" SHELL_CFG_PROMPT);
+    }
+    return ret;
+}
+
+/**
+ * @brief Advances the shell by one step, call it from the main loop.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: The shell isn't initialized.
+ */
+Std_ReturnType Shell_Tasks(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_tx_free = ZERO_INIT;
+    uint8 l_data = ZERO_INIT;
+    uint8 l_read = ZERO_INIT;
+
+    Eusart_Buffer_Status(NULL, &l_tx_free);
+    if(ZERO_INIT == shell_initialized)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(l_tx_free < SHELL_CFG_OUTPUT_RESERVE)
+    {
+        /* Wait for the console to drain, a step must not lose output */
+    }
+    else if(SHELL_JOB_NONE != shell_job)
+    {
+        Shell_Job_Step();
+    }
+    else if(shell_line_ready)
+    {
+        Shell_Execute();
+        shell_line_len = ZERO_INIT;
+        shell_line_ready = ZERO_INIT;
+        if(SHELL_JOB_NONE == shell_job)
+        {
+            Shell_Print(SHELL_CFG_PROMPT);
+        }else{/* Nothing */}
+    }
+    else
+    {
+        //Take what was typed, an echo needs at most 3 bytes
+        do
+        {
+            l_read = ZERO_INIT;
+            Eusart_Buffer_Status(NULL, &l_tx_free);
+            if(l_tx_free >= 3U)
+            {
+                Eusart_Read(&l_data, 1, &l_read);
+            }else{/* Nothing */}
+            if(l_read)
+            {
+                Shell_Input(l_data);
+            }else{/* Nothing */}
+        }while(l_read && ZERO_INIT == shell_line_ready);
+    }
+    return ret;
+}
+
+/**
+ * @brief Writes formatted output to the console, see format.h for the conversions.
+ *
+ * @param fmt The format string.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Shell_Print(const char *fmt, ...)
+{
+    Std_ReturnType ret = E_OK;
+    va_list l_args;
+
+    va_start(l_args, fmt);
+    ret = Format_VPrint(&shell_sink, fmt, l_args);
+    va_end(l_args);
+    return ret;
+}
+
+/**
+ * @brief Parses a decimal or 0x hexadecimal number.
+ *
+ * @param str The word to parse.
+ * @param value A pointer to store the value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Not a number, or larger than 0xFFFF.
+ */
+Std_ReturnType Shell_Parse_Number(const char *str, uint16 *value)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_value = ZERO_INIT;
+    uint8 l_base = 10;
+    uint8 l_digit = ZERO_INIT;
+
+    if(NULL == str || NULL == value || '\0' == *str)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if('0' == str[0] && ('x' == str[1] || 'X' == str[1]))
+        {
+            l_base = 16;
+            str += 2;
+            ret = ('\0' == *str) ? E_NOT_OK : E_OK;
+        }else{/* Nothing */}
+        while(E_OK == ret && '\0' != *str)
+        {
+            if(*str >= '0' && *str <= '9')
+            {
+                l_digit = (uint8)(*str - '0');
+            }
+            else if(16 == l_base && *str >= 'a' && *str <= 'f')
+            {
+                l_digit = (uint8)(*str - 'a' + 10);
+            }
+            else if(16 == l_base && *str >= 'A' && *str <= 'F')
+            {
+                l_digit = (uint8)(*str - 'A' + 10);
+            }
+            else
+            {
+                ret = E_NOT_OK;
+            }
+            l_value = (l_value * l_base) + l_digit;
+            if(l_value > 0xFFFFUL)
+            {
+                ret = E_NOT_OK;
+            }else{/* Nothing */}
+            str++;
+        }
+        if(E_OK == ret)
+        {
+            *value = (uint16)l_value;
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief Sink of Shell_Print(), drops the character when the TX ring is full.
+ *
+ */
+static void Shell_PutChar(void *context, uint8 data)
+{
+    Eusart_Write(&data, 1);
+}
+
+/**
+ * @brief Line editing: printable characters are echoed, backspace erases, CR or LF ends the line.
+ *
+ */
+static void Shell_Input(uint8 data)
+{
+    if('\n' == data && shell_last_cr)
+    {
+        /* Second half of a CR LF pair */
+        shell_last_cr = ZERO_INIT;
+    }
+    else if('\r' == data || '\n' == data)
+    {
+        shell_last_cr = (uint8)('\r' == data);
+        shell_line[shell_line_len] = '\0';
+        shell_line_ready = 1;
+        Shell_Print("\r\n");
+    }
+    else
+    {
+        shell_last_cr = ZERO_INIT;
+        if(0x08U == data || 0x7FU == data)
+        {
+            if(shell_line_len)
+            {
+                shell_line_len--;
+                Shell_Print("\b \b");
+            }else{/* Nothing */}
+        }
+        else if(data >= 0x20U && data < 0x7FU && shell_line_len < SHELL_CFG_LINE_SIZE)
+        {
+            shell_line[shell_line_len] = (char)data;
+            shell_line_len++;
+            Shell_Print("%c", data);
+        }
+        else
+        {
+            /* Control characters and overlong lines are ignored */
+        }
+    }
+}
+
+/**
+ * @brief Runs the command on the completed line.
+ *
+ */
+static void Shell_Execute(void)
+{
+    char *l_argv[SHELL_CFG_MAX_ARGS];
+    uint8 l_argc = Shell_Tokenize(shell_line, l_argv);
+    const shell_command_t *l_command = NULL;
+
+    if(ZERO_INIT == l_argc)
+    {
+        /* Empty line */
+    }
+    else
+    {
+        l_command = Shell_Find(l_argv[0]);
+        if(NULL == l_command)
+        {
+            Shell_Print("unknown command, try help\r\n");
+        }
+        else if(E_OK != l_command->Shell_Handler(l_argc, l_argv))
+        {
+            Shell_Print("usage: %s %s\r\n", l_command->name, l_command->usage);
+        }else{/* Nothing */}
+    }
+}
+
+/**
+ * @brief Splits the line into words in place, the separators become terminators.
+ *
+ * @return uint8 Number of words, extra words are ignored.
+ */
+static uint8 Shell_Tokenize(char *line, char *argv[])
+{
+    uint8 l_argc = ZERO_INIT;
+
+    while('\0' != *line && l_argc < SHELL_CFG_MAX_ARGS)
+    {
+        while(' ' == *line)
+        {
+            *line = '\0';
+            line++;
+        }
+        if('\0' != *line)
+        {
+            argv[l_argc] = line;
+            l_argc++;
+            while('\0' != *line && ' ' != *line)
+            {
+                line++;
+            }
+        }else{/* Nothing */}
+    }
+    //Terminate the last word if the word count was reached
+    if(' ' == *line)
+    {
+        *line = '\0';
+    }else{/* Nothing */}
+    return l_argc;
+}
+
+/**
+ * @brief Looks a command up, built-in commands first.
+ *
+ */
+static const shell_command_t *Shell_Find(const char *name)
+{
+    const shell_command_t *l_command = NULL;
+    const shell_command_t *l_found = NULL;
+    uint8 l_index = ZERO_INIT;
+
+    for(l_index = 0; l_index < (uint8)(SHELL_BUILTIN_COUNT + shell_command_count) && NULL == l_found; l_index++)
+    {
+        l_command = Shell_Command_At(l_index);
+        if(0 == strcmp(name, l_command->name))
+        {
+            l_found = l_command;
+        }else{/* Nothing */}
+    }
+    return l_found;
+}
+
+/**
+ * @brief Built-in commands followed by the application commands.
+ *
+ */
+static const shell_command_t *Shell_Command_At(uint8 index)
+{
+    return (index < SHELL_BUILTIN_COUNT) ? &shell_builtins[index] :
+                                           &shell_commands[index - SHELL_BUILTIN_COUNT];
+}
+
+/**
+ * @brief Writes one line of a multi-line output.
+ *
+ */
+static void Shell_Job_Step(void)
+{
+    const shell_command_t *l_command = NULL;
+    uint8 l_row = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_data = ZERO_INIT;
+    uint8 l_busy = ZERO_INIT;
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+    usart_stats_t l_stats;
+#endif
+
+    if(SHELL_JOB_HELP == shell_job)
+    {
+        l_command = Shell_Command_At((uint8)shell_job_address);
+        Shell_Print("  %s %s\r\n", l_command->name, l_command->usage);
+        shell_job_address++;
+        shell_job_remaining--;
+    }
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+    else if(SHELL_JOB_STATS == shell_job)
+    {
+        //Second line of stats, the first one and this one each fit the output reserve
+        Eusart_Get_Stats(&l_stats);
+        Shell_Print("flow thr %u ticks %lu\r\n", l_stats.rx_throttle_events,
+                    (unsigned long)l_stats.rx_throttled_ticks);
+        shell_job_remaining = ZERO_INIT;
+    }
+#endif
+    else
+    {
+        EEPROM_Write_Busy(&l_busy);
+        if(SHELL_JOB_EERD == shell_job && l_busy)
+        {
+            /* The EEPROM can't be read during a write cycle */
+        }
+        else
+        {
+            l_row = (shell_job_remaining < SHELL_DUMP_ROW) ? (uint8)shell_job_remaining : SHELL_DUMP_ROW;
+            Shell_Print("%03X:", shell_job_address);
+            for(l_index = 0; l_index < l_row; l_index++)
+            {
+                if(SHELL_JOB_EERD == shell_job)
+                {
+                    EEPROM_ReadByte(shell_job_address + l_index, &l_data);
+                    Shell_Print(" %02X", l_data);
+                }
+                else if(Shell_Peek_Allowed(shell_job_address + l_index))
+                {
+                    l_data = *(volatile uint8 *)(shell_job_address + l_index);
+                    Shell_Print(" %02X", l_data);
+                }
+                else
+                {
+                    //Reading it would change the peripheral state
+                    Shell_Print(" --");
+                }
+            }
+            Shell_Print("\r\n");
+            shell_job_address += l_row;
+            shell_job_remaining -= l_row;
+        }
+    }
+    if(ZERO_INIT == shell_job_remaining)
+    {
+        shell_job = SHELL_JOB_NONE;
+        Shell_Print(SHELL_CFG_PROMPT);
+    }else{/* Nothing */}
+}
+
+/**
+ * @brief Parses "<address> [count]" into the job range.
+ *
+ */
+static Std_ReturnType Shell_Parse_Range(uint8 argc, char *argv[], uint16 end)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_address = ZERO_INIT;
+    uint16 l_count = 1;
+
+    if(argc < 2 || argc > 3)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = Shell_Parse_Number(argv[1], &l_address);
+        if(3 == argc)
+        {
+            ret &= Shell_Parse_Number(argv[2], &l_count);
+        }else{/* Nothing */}
+        if(E_OK == ret && ZERO_INIT != l_count && l_address < end && l_count <= (uint16)(end - l_address))
+        {
+            shell_job_address = l_address;
+            shell_job_remaining = l_count;
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Tells if peek may read a data memory address, SFRs changed by a read are refused.
+ *
+ */
+static uint8 Shell_Peek_Allowed(uint16 address)
+{
+    uint8 l_allowed = 1;
+
+    if((address >= SHELL_SFR_INDIRECT_FIRST && address <= SHELL_SFR_INDIRECT_LAST && (address & 0x07U) >= 3U) ||
+       SHELL_SFR_PORTB == address || SHELL_SFR_SSPBUF == address || SHELL_SFR_RCREG == address)
+    {
+        l_allowed = ZERO_INIT;
+    }else{/* Nothing */}
+    return l_allowed;
+}
+
+/**
+ * @brief help: lists the commands, one line per Shell_Tasks() step.
+ *
+ */
+static Std_ReturnType Shell_Cmd_Help(uint8 argc, char *argv[])
+{
+    shell_job_address = ZERO_INIT;
+    shell_job_remaining = (uint16)(SHELL_BUILTIN_COUNT + shell_command_count);
+    shell_job = SHELL_JOB_HELP;
+    return E_OK;
+}
+
+/**
+ * @brief peek: dumps data memory, one row per step. SFRs changed by a read print as --.
+ *
+ */
+static Std_ReturnType Shell_Cmd_Peek(uint8 argc, char *argv[])
+{
+    Std_ReturnType ret = Shell_Parse_Range(argc, argv, SHELL_RAM_END);
+
+    if(E_OK == ret)
+    {
+        shell_job = SHELL_JOB_PEEK;
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief poke: writes one data memory byte, SFRs included, with no check of the effect.
+ *
+ */
+static Std_ReturnType Shell_Cmd_Poke(uint8 argc, char *argv[])
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_address = ZERO_INIT;
+    uint16 l_value = ZERO_INIT;
+
+    if(3 != argc || E_OK != Shell_Parse_Number(argv[1], &l_address) ||
+       E_OK != Shell_Parse_Number(argv[2], &l_value) || l_address >= SHELL_RAM_END || l_value > 0xFF)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *(volatile uint8 *)l_address = (uint8)l_value;
+    }
+    return ret;
+}
+
+/**
+ * @brief eerd: dumps the data EEPROM, one row per step, waiting out a write cycle.
+ *
+ */
+static Std_ReturnType Shell_Cmd_Eerd(uint8 argc, char *argv[])
+{
+    Std_ReturnType ret = Shell_Parse_Range(argc, argv, SHELL_EEPROM_END);
+
+    if(E_OK == ret)
+    {
+        shell_job = SHELL_JOB_EERD;
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief eewr: starts an EEPROM byte write and returns, "eeprom busy" if a write is running.
+ *
+ */
+static Std_ReturnType Shell_Cmd_Eewr(uint8 argc, char *argv[])
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_address = ZERO_INIT;
+    uint16 l_value = ZERO_INIT;
+
+    if(3 != argc || E_OK != Shell_Parse_Number(argv[1], &l_address) ||
+       E_OK != Shell_Parse_Number(argv[2], &l_value) || l_address >= SHELL_EEPROM_END || l_value > 0xFF)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(E_OK != EEPROM_WriteByte_Start(l_address, (uint8)l_value))
+    {
+        Shell_Print("eeprom busy\r\n");
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief stats: prints the UART error counters, then the flow control counters on the next step.
+ *
+ */
+static Std_ReturnType Shell_Cmd_Stats(uint8 argc, char *argv[])
+{
+    usart_stats_t l_stats;
+
+    Eusart_Get_Stats(&l_stats);
+    Shell_Print("uart ovr %u fer %u drop %u\r\n", l_stats.rx_overrun_errors,
+                l_stats.rx_framing_errors, l_stats.rx_dropped);
+#if EUSART_CFG_FLOW_CONTROL==EUSART_CFG_FEATURE_ENABLE
+    //The flow control line goes out on the next step
+    shell_job_remaining = 1;
+    shell_job = SHELL_JOB_STATS;
+#endif
+    return E_OK;
+}
@@ -0,0 +1,128 @@
+/*
+ * File:   shell.h
+ * Author: Mohamed Sameh
+ *
+ * Command-line shell over the EUSART, for debugging through a serial console.
+ * Shell_Tasks() runs from the main loop and never waits: it reads what the RX ring holds,
+ * and only runs a step once the TX ring has SHELL_CFG_OUTPUT_RESERVE bytes free, so the
+ * output of a step always fits. Long outputs (memory dumps, help) are produced one line
+ * per call. The line is split into words in place, nothing is copied or allocated.
+ *
+ * Built-in commands (numbers are decimal or 0x hexadecimal):
+ *   help                       list the commands
+ *   peek <address> [count]     dump RAM or SFRs (0x000 to 0xFFF), SFRs changed by a
+ *                              read show as --
+ *   poke <address> <value>     write a RAM or SFR byte
+ *   eerd <address> [count]     dump the data EEPROM
+ *   eewr <address> <value>     write a data EEPROM byte (non-blocking)
+ *   stats                      driver statistics
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef SHELL_H
+#define	SHELL_H
+
+/* -------------- Includes -------------- */
+#include "../../MCAL/USART/usart.h"
+#include "../../MCAL/EEPROM/eeprom.h"
+#include "../Format/format.h"
+#include "shell_cfg.h"
+
+/* -------------- Macro Declarations ------------- */
+#if EUSART_CFG_BUFFERED!=EUSART_CFG_FEATURE_ENABLE
+#error "Shell needs EUSART_CFG_BUFFERED"
+#endif
+#if (SHELL_CFG_OUTPUT_RESERVE < 40) || (SHELL_CFG_OUTPUT_RESERVE > EUSART_CFG_TX_BUFFER_SIZE)
+#error "SHELL_CFG_OUTPUT_RESERVE must be between 40 and EUSART_CFG_TX_BUFFER_SIZE"
+#endif
+#if (SHELL_CFG_LINE_SIZE < 8) || (SHELL_CFG_LINE_SIZE > 254)
+#error "SHELL_CFG_LINE_SIZE must be between 8 and 254"
+#endif
+
+//Bytes per dump line.
+#define SHELL_DUMP_ROW              8U
+//Data memory of the PIC18F4620, SFRs included.
+#define SHELL_RAM_END               0x1000U
+//SFRs changed by a read, peek doesn't read them: INDFx, POSTINCx, POSTDECx, PREINCx and
+//PLUSWx in the range (bits 2:0 at 3 or more) use or move the FSRs, PORTB ends the RB
+//change mismatch, SSPBUF clears BF and RCREG pops the receive FIFO.
+#define SHELL_SFR_INDIRECT_FIRST    0xFD8U
+#define SHELL_SFR_INDIRECT_LAST     0xFEFU
+#define SHELL_SFR_PORTB             0xF81U
+#define SHELL_SFR_SSPBUF            0xFC9U
+#define SHELL_SFR_RCREG             0xFAEU
+#define SHELL_EEPROM_END            0x0400U
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+/**
+ * @brief Shell Command, application tables are declared const so they stay in ROM
+ *
+ * The handler gets the words of the line, argv[0] is the command name. It may write up
+ * to SHELL_CFG_OUTPUT_RESERVE bytes with Shell_Print(), and returns E_NOT_OK on bad
+ * arguments so the shell prints the usage.
+ */
+typedef struct
+{
+    const char *name;
+    const char *usage;          /* Arguments and description, shown by help */
+    Std_ReturnType (* Shell_Handler)(uint8 argc, char *argv[]);
+}shell_command_t;
+
+/**
+ * @brief Shell Configurations Structure
+ */
+typedef struct
+{
+    const shell_command_t *commands;    /* Application commands (can be NULL) */
+    uint8 command_count;
+}shell_t;
+
+/* -------------- Functions Declarations --------------*/
+/**
+ * @brief Initializes the shell and prints the prompt.
+ *
+ * Eusart_Async_Init() must be called first, the shell reads the EUSART RX ring.
+ *
+ * @param _shell A pointer to the Shell Configurations Structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Shell_Init(const shell_t *_shell);
+
+/**
+ * @brief Advances the shell by one step, call it from the main loop.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: The shell isn't initialized.
+ */
+Std_ReturnType Shell_Tasks(void);
+
+/**
+ * @brief Writes formatted output to the console, see format.h for the conversions.
+ *
+ * Characters that don't fit the TX ring are dropped, this never waits.
+ *
+ * @param fmt The format string.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Shell_Print(const char *fmt, ...);
+
+/**
+ * @brief Parses a decimal or 0x hexadecimal number.
+ *
+ * @param str The word to parse.
+ * @param value A pointer to store the value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Not a number, or larger than 0xFFFF.
+ */
+Std_ReturnType Shell_Parse_Number(const char *str, uint16 *value);
+
+#endif	/* SHELL_H */
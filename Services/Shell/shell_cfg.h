@@ -0,0 +1,29 @@
+/*
+ * File:   shell_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 18, 2026
+ */
+
+#ifndef SHELL_CFG_H
+#define	SHELL_CFG_H
+
+/* -------------- Includes -------------- */
+
+/* -------------- Macro Declarations ------------- */
+//Longest command line in characters, the terminator excluded.
+#define SHELL_CFG_LINE_SIZE         48U
+//Most words on a line, the command name included.
+#define SHELL_CFG_MAX_ARGS          6U
+//Free TX ring space needed before a step runs: a step never writes more than this.
+#define SHELL_CFG_OUTPUT_RESERVE    48U
+#define SHELL_CFG_PROMPT            "> "
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+
+/* -------------- Functions Declarations --------------*/
+
+
+#endif	/* SHELL_CFG_H */